@@ -14,10 +14,15 @@ public:
   virtual void act() override;
 
 protected:
+  // Add (or reuse) the shared cross-section library of a FileTransportMaterial.
+  void addXSLibrary();
+
   std::string _parent_transport_system;
   unsigned int _num_groups;
   MooseEnum _particle;
   MooseEnum _scheme;
+  // Whether the transport system requires diffusion properties for DSA.
+  bool _use_dsa;
   bool _disable_fission;
 
   bool _is_init;
@@ -30,6 +30,8 @@ protected:
   unsigned int _num_groups;
   MooseEnum _particle;
   MooseEnum _scheme;
+  // Whether the transport system requires diffusion properties for DSA.
+  bool _use_dsa;
   bool _disable_fission;
   const unsigned int _anisotropy;
 
@@ -4,6 +4,7 @@
 
 #include "NuclearData.h"
 #include "Nuclide.h"
+#include "DepletionGraph.h"
 
 class DepletionLibraryAction : public Action
 {
@@ -42,14 +43,25 @@ public:
     return _nuclide_activation_parents.at(nuclide);
   }
 
-  // Get all nuclides in the depletion system given a list of initial nuclides (in-place).
+  // Get all nuclides in the depletion system given a list of initial nuclides (in-place). Nuclides
+  // in the chain are returned in topological order (parents before children).
   void getNuclidesFromInitial(std::vector<std::string> & nuclides) const;
   // Get the number of energy groups that this depletion library supports.
   unsigned int numGroups() const { return _num_groups; }
 
 protected:
   void loadOpenMCDepletionXML();
+  // Indexes the loaded chain and finds the parents of each nuclide.
+  void buildChainGraph();
+  // Loads either the XML microscopic cross-section library or its binary form (see MGXSBinary).
   void loadOpenMCMicoXSXML();
+  void loadMicoXSBinary();
+
+  // Helpers shared by the microscopic cross-section loaders.
+  void setMicoXSUnits(const std::string & energy_units, const std::string & xs_units);
+  void checkGroupBounds();
+  bool hasMicoXSNuclide(const std::string & name) const;
+  void addMicoXS(const std::string & name, const std::string & type, std::vector<Real> & xs);
 
   void parseToVector(const std::string & string_rep, std::vector<Real> & real_rep);
 
@@ -63,6 +75,9 @@ protected:
 
   std::unordered_map<std::string, NuclearData::Nuclide> _nuclide_list;
 
+  // The indexed depletion chain.
+  NuclearData::DepletionGraph _chain_graph;
+
   // Pre-process the various decay and activation parents for each nuclide.
   std::unordered_map<std::string, std::vector<std::string>> _nuclide_decay_parents;
   std::unordered_map<std::string, std::vector<std::string>> _nuclide_activation_parents;
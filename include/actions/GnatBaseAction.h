@@ -21,6 +21,8 @@ protected:
 
   // Add a variables.
   void addVariable(const std::string & var_name);
+  // Add an array variable with num_components components.
+  void addArrayVariable(const std::string & var_name, unsigned int num_components);
 
   // The execution type (steady-state or transient) and the debug output verbosity.
   ExecutionType _exec_type;
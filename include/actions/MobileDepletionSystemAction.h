@@ -31,6 +31,11 @@ protected:
   void applyIsotopeParameters(InputParameters & params, bool apply_density = true);
   void addICs(const std::string & nuclide_var_name);
   void addMaterials(const std::string & nuclide_var_name);
+  // Add the material which computes the one-group reaction rates of all nuclides.
+  void addReactionRateMaterial();
+  // Add the user object which integrates the reactions and decays of all nuclides separately from
+  // mass transport.
+  void addReactionSplitting();
 
   // Finite element variables.
   void addKernels(const std::string & nuclide_var_name);
@@ -59,6 +64,9 @@ protected:
     FV = 1u
   } _scheme;
 
+  // Whether reactions and decays are operator split from mass transport.
+  const bool _split_reactions;
+
   // The coupled Navier-Stokes finite volume physics.
   const WCNSFVFlowPhysics * _coupled_ns_fv;
 
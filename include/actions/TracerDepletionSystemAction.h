@@ -50,6 +50,11 @@ protected:
   void addRadiationAuxVariables();
   void addRadiationAuxKernels();
 
+  // Auxvariables, initial conditions and auxkernels for the CRAM depletion scheme.
+  void addCRAMAuxVariables();
+  void addCRAMICs();
+  void addCRAMAuxKernels();
+
   unsigned int _mesh_dims;
   bool _using_moose_ns;
 
@@ -57,7 +62,8 @@ protected:
   enum class NuclideScheme
   {
     SUPGFE = 0u,
-    FV = 1u
+    FV = 1u,
+    CRAM = 2u
   } _scheme;
 
   // The coupled Navier-Stokes finite volume physics.
@@ -80,6 +86,8 @@ protected:
   const std::vector<std::string> & _extra_nuclides;
   const std::vector<Real> & _extra_nuclide_number_densities;
   std::unordered_map<std::string, Real> _total_nuclide_list;
+  // The nuclides in the order of the components of the CRAM number density array variable.
+  std::vector<std::string> _cram_nuclides;
 
   // The boundary conditions in the system.
   const std::vector<BoundaryName> & _inlet_boundaries;
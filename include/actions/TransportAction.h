@@ -30,6 +30,8 @@ protected:
 
   // Individual act functions for each scheme.
   void actSAAFCFEM();
+  void actDSA();
+  void actArraySAAFCFEM();
   void actDiffusion();
   void actTransfer();
 
@@ -39,18 +41,27 @@ protected:
   // Member functions to initialize the MOOSE objects required for all schemes.
   void modifyOutputs();
   void addSNUserObjects();
+  void addSNMaterials();
   void addSNBCs(const std::string & var_name, unsigned int g, unsigned int n);
   void addSNICs(const std::string & var_name, unsigned int g);
   void addAuxVariables(const std::string & var_name);
   // is_output = true as a default parameter.
   // TODO: Fix this for scattering moments.
   void addAuxKernels(const std::string & var_name, unsigned int g, unsigned int l, int m);
+  // The array auxvariable and auxkernels which compute all flux moments in a single pass.
+  void addArrayAuxVariables(const std::string & var_name, unsigned int num_components);
+  void addArrayAuxKernels(const std::string & var_name);
 
   // Member functions to initialize the MOOSE objects required for the
   // CGFEM-SAAF scheme.
   void addSAAFKernels(const std::string & var_name, unsigned int g, unsigned int n);
   void addSAAFDiracKernels(const std::string & var_name, unsigned int g, unsigned int n);
 
+  // Member functions to initialize the MOOSE objects required for the
+  // array CGFEM-SAAF scheme. All ordinates of group g are stored in var_name.
+  void addArraySNBCs(const std::string & var_name, unsigned int g);
+  void addArraySAAFKernels(const std::string & var_name, unsigned int g);
+
   // Member functions to initialize the MOOSE objects required for the
   // diffusion approximation scheme.
   void addDiffusionBCs(const std::string & var_name);
@@ -62,6 +73,14 @@ protected:
   void addTransfers(const std::string & to_var_name, const std::string & source_var_name);
   void addUncTransfers(const std::string & to_var_name, const std::string & source_var_name);
 
+  // Member functions to initialize the MOOSE objects required for diffusion synthetic
+  // acceleration of source iteration.
+  void addDSABCs(const std::string & var_name);
+  void addDSAKernels(const std::string & var_name, unsigned int g);
+
+  // Member function to add the source iteration convergence post-processor.
+  void addSourceIterationPP();
+
   // Member function to add conservative transfer post-processors.
   void addDestinationConservativePP(const std::string & to_var_name);
   void addSourceConservativePP(const std::string & source_var_name);
@@ -134,9 +153,26 @@ protected:
   const std::string & _uncollided_source_flux_moment_names;
   const bool _using_uncollided;
 
+  // Whether the scattering source is lagged and converged with source iteration.
+  const bool _source_iteration;
+  // Whether source iteration is accelerated with diffusion synthetic acceleration.
+  const bool _use_dsa;
+
+  // Whether the flux moments are computed once per quadrature point by SNFluxMomentMaterial and
+  // shared between the SAAF scattering and fission kernels.
+  const bool _use_flux_moment_material;
+
+  // Whether all flux moments are computed in a single pass and stored in one array auxvariable.
+  const bool _array_flux_moments;
+  // Whether the individual flux moment auxvariables are required. They're consumed by the moment
+  // scattering and fission kernels, restarts and conservative transfers.
+  const bool _add_moment_auxvariables;
+
   // List of the names for all angular flux variables and flux moments.
   std::unordered_map<unsigned int, std::vector<VariableName>> _group_angular_fluxes;
   std::unordered_map<unsigned int, std::vector<VariableName>> _group_flux_moments;
+  // Names of the DSA scalar flux corrections, ordered by group.
+  std::vector<VariableName> _group_dsa_corrections;
 
   // Source scaling.
   Real _source_scale_factor;
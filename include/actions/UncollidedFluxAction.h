@@ -22,6 +22,14 @@ protected:
   void addUncollidedRayAuxVars();
   void addUncollidedRayAuxKernels();
   void addUncollidedRayPostProcessors();
+  void addUncollidedRayStudyPostProcessors();
+
+  // Whether the element-averaged total cross-sections are required by the ray study.
+  bool rtNeedsTotalXS() const
+  {
+    return getParam<bool>("rt_cache_ray_segments") || getParam<bool>("rt_skip_unchanged") ||
+           getParam<Real>("rt_volume_ray_tolerance") > 0.0;
+  }
 
   // Member functions required to add objects required for the SASF uncollided flux treatment.
   void addUncollidedSASFVariables();
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "ArrayAuxKernel.h"
+
+// Copies a std::vector<Real> material property into an array variable with one component per
+// entry of the property (ex: the group-wise total cross-sections of a transport system).
+class ArrayMaterialStdVectorAux : public ArrayAuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArrayMaterialStdVectorAux(const InputParameters & parameters);
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  const MaterialProperty<std::vector<Real>> & _prop;
+}; // class ArrayMaterialStdVectorAux
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "AuxKernel.h"
+
+#include "AQProvider.h"
+
+// Computes a flux moment from an array variable which stores all angular flux ordinates of a group.
+class ArrayParticleFluxMoment : public AuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArrayParticleFluxMoment(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+
+  const AQProvider & _aq;
+
+  const ArrayVariableValue & _flux_ordinates;
+
+  const unsigned int _degree;
+  const int _order;
+
+  const Real _scale_factor;
+
+  const VariableValue * _uncollided_flux_moment;
+
+  // The pre-computed products of the spherical harmonics and quadrature weights for all ordinates.
+  RealEigenVector _weighted_y_l_m;
+}; // class ArrayParticleFluxMoment
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ArrayAuxKernel.h"
+
+#include "BurnupMatrix.h"
+#include "CRAMSolver.h"
+
+class DepletionDataProvider;
+
+// Advances the number densities of all nuclides in a depletion system over each timestep with the
+// Chebyshev Rational Approximation Method (CRAM). The number densities are stored in an elemental
+// array variable with one component per nuclide, and the burnup matrix is assembled once per
+// element from the element-averaged group scalar fluxes.
+class CRAMDepletionAux : public ArrayAuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  CRAMDepletionAux(const InputParameters & parameters);
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  const DepletionDataProvider & _data_provider;
+
+  // The burnup matrix of the nuclides in the array variable, in the order of the components.
+  const NuclearData::BurnupMatrix _burnup_matrix;
+  NuclearData::CRAMSolver _solver;
+
+  // The number densities at the beginning of the timestep.
+  const ArrayVariableValue & _u_old;
+
+  std::vector<const VariableValue *> _group_scalar_fluxes;
+
+  // Scratch storage for the element being depleted.
+  std::vector<Real> _group_fluxes;
+  std::vector<Real> _reaction_rates;
+  std::vector<Real> _values;
+  std::vector<Real> _number_densities;
+  RealEigenVector _depleted;
+}; // class CRAMDepletionAux
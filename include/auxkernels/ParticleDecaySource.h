@@ -27,6 +27,10 @@ protected:
   std::vector<const Moose::Functor<ADReal> *> _fun_nuclide_concentrations;
 
   std::vector<std::string> _nuclide_names;
+  // The decay constant of each nuclide for the current group.
+  std::vector<Real> _group_decay_consts;
+  // Factors which convert each nuclide concentration into a number density.
+  std::vector<Real> _number_density_factors;
 
   const DepletionDataProvider * _data_provider;
 
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ArrayAuxKernel.h"
+
+class DepletionDataProvider;
+
+// Computes the decay source term (gamma or neutron) of all energy groups from radionuclides in a
+// single pass and stores them in an array variable with one component per group.
+class ParticleDecaySourceArray : public ArrayAuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  ParticleDecaySourceArray(const InputParameters & parameters);
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  const Particletype _particle;
+
+  const std::vector<Real> & _group_bounds;
+  const unsigned int _num_groups;
+
+  // The concentration variables in either variable (FE) or functor (FV) form.
+  const bool _is_fe;
+  std::vector<const ADVariableValue *> _var_nuclide_concentrations;
+  std::vector<const Moose::Functor<ADReal> *> _fun_nuclide_concentrations;
+
+  const DepletionDataProvider * _data_provider;
+
+  const bool _is_mass_density;
+
+  // The group-wise emission rates of each nuclide, scaled to convert the nuclide concentration
+  // into a number density.
+  std::vector<RealEigenVector> _nuclide_emission_rates;
+}; // class ParticleDecaySourceArray
@@ -23,5 +23,10 @@ protected:
 
   const Real _scale_factor;
 
+  // The spherical harmonics of this moment multiplied by the quadrature weight for each ordinate
+  // (w_{n}Y_{l,m}(Omega_{n})).
+  std::vector<Real> _weighted_y_l_m;
+
   const VariableValue * _uncollided_flux_moment;
+  const VariableValue * _dsa_correction;
 }; // class ParticleFluxMoment
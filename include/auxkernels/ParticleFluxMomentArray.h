@@ -0,0 +1,39 @@
+#pragma once
+
+#include "ArrayAuxKernel.h"
+
+#include "AQProvider.h"
+
+// Computes all flux moments of all energy groups in a single sweep over the angular flux ordinates
+// and stores them in an array variable. Components are ordered g -> l -> m.
+class ParticleFluxMomentArray : public ArrayAuxKernel
+{
+public:
+  static InputParameters validParams();
+
+  ParticleFluxMomentArray(const InputParameters & parameters);
+
+protected:
+  virtual RealEigenVector computeValue() override;
+
+  const AQProvider & _aq;
+
+  const unsigned int _num_groups;
+  const unsigned int _max_anisotropy;
+  unsigned int _num_moments_per_group;
+
+  const Real _scale_factor;
+
+  // The flux ordinates, either one standard variable per group and ordinate or one array variable
+  // per group.
+  std::vector<const VariableValue *> _group_flux_ordinates;
+  std::vector<const ArrayVariableValue *> _group_array_flux_ordinates;
+
+  // The uncollided flux moments (one per group and moment) and the DSA scalar flux corrections (one
+  // per group).
+  std::vector<const VariableValue *> _uncollided_flux_moments;
+  std::vector<const VariableValue *> _dsa_corrections;
+
+  // The flux ordinates of the current quadrature point (ordinates x groups).
+  RealEigenMatrix _qp_ordinates;
+}; // class ParticleFluxMomentArray
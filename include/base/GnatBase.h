@@ -31,7 +31,8 @@ enum class TransportScheme
 {
   SAAFCFEM = 0u,
   DiffusionApprox = 1u,
-  FluxMomentTransfer = 2u
+  FluxMomentTransfer = 2u,
+  ArraySAAFCFEM = 3u
 }; // enum class Scheme
 
 // An enum for the execution type of the problem. Either steady-state or
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ArrayIntegratedBC.h"
+
+#include "AQProvider.h"
+
+// A base class for all array neutron transport boundary conditions. Component n of the array
+// variable is the angular flux along the quadrature direction n.
+class ArraySNBaseBC : public ArrayIntegratedBC
+{
+public:
+  static InputParameters validParams();
+
+  ArraySNBaseBC(const InputParameters & parameters);
+
+protected:
+  // Computes max(n * Omega_{n}, 0) for all ordinates at the current quadrature point.
+  const RealEigenVector & computeQpOutgoing();
+
+  const AQProvider & _aq;
+  Real _symmetry_factor;
+
+  // The quadrature directions stored row-wise (Omega_{n} = _omega.row(n)).
+  RealVectorArrayValue _omega;
+
+  // Work vector for the outgoing streaming factors.
+  RealEigenVector _qp_outgoing;
+}; // class ArraySNBaseBC
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ArraySNBaseBC.h"
+
+class ArraySNSourceBC : public ArraySNBaseBC
+{
+public:
+  static InputParameters validParams();
+
+  ArraySNSourceBC(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  const unsigned int _num_groups;  // G
+  const unsigned int _group_index; // g
+
+  // The source moments for all groups. See SNSourceBC for the expected ordering.
+  std::vector<Real> _source_moments;
+
+  const unsigned int _source_anisotropy;
+  unsigned int _max_source_moments;
+
+  // The pre-computed incoming angular flux for every ordinate in the current group.
+  RealEigenVector _ordinate_source;
+}; // class ArraySNSourceBC
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "ArraySNBaseBC.h"
+
+class ArraySNVacuumBC : public ArraySNBaseBC
+{
+public:
+  static InputParameters validParams();
+
+  ArraySNVacuumBC(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+}; // class ArraySNVacuumBC
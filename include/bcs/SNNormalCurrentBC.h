@@ -25,4 +25,9 @@ protected:
 
   // Anisotropy of the imposed current. Used to increase the accuracy of the SH expansion.
   const unsigned int _current_anisotropy;
+
+  // All spherical harmonics of the current ordinate and work storage for the harmonics of the
+  // boundary normal, both in the ordering of RealSphericalHarmonics::evaluateAll().
+  std::vector<Real> _y_l_m;
+  std::vector<Real> _normal_y_l_m;
 }; // class ADSNNormalCurrentBC
@@ -52,4 +52,12 @@ protected:
 
   const unsigned int _source_anisotropy;
   unsigned int _max_source_moments;
+
+  // Evaluates the incoming angular source of the current ordinate for the dimensionality P.
+  template <ProblemType P>
+  Real computeInflowSource() const;
+
+  // The incoming angular source of the current ordinate. The source moments are constant, and so
+  // the expansion is evaluated once at construction.
+  Real _inflow_source;
 }; // class ADSNSourceBC
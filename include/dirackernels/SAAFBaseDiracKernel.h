@@ -15,8 +15,8 @@ protected:
   const unsigned int _ordinate_index; // n
   const unsigned int _group_index;    // g
 
-  const ADMaterialProperty<std::vector<Real>> & _sigma_r_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_r_g;
 
   // SAAF stabilization parameters.
-  const ADMaterialProperty<std::vector<Real>> & _saaf_tau;
+  const MaterialProperty<std::vector<Real>> & _saaf_tau;
 }; // class SAAFBaseDiracKernel
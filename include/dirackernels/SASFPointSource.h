@@ -22,5 +22,5 @@ protected:
   // g
   const unsigned int _group_index;
   // SAAF stabilization parameters.
-  const ADMaterialProperty<std::vector<Real>> & _saaf_tau;
+  const MaterialProperty<std::vector<Real>> & _saaf_tau;
 }; // class SASFPointSource
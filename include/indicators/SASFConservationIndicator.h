@@ -18,5 +18,5 @@ protected:
   // g
   const unsigned int _group_index;
   // Total cross-section.
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
 };
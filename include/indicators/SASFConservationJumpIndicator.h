@@ -20,7 +20,7 @@ protected:
   // g
   const unsigned int _group_index;
   // Total cross section for the current mesh element.
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_c_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_c_g;
   // Total cross section for the neighboring mesh element.
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_n_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_n_g;
 };
@@ -12,16 +12,14 @@ public:
 protected:
   virtual ADReal computeQpResidual() override;
 
-  // Number of energy groups.
-  const unsigned int _num_groups;
-
-  // A vector to store all of the group scalar fluxes.
-  std::vector<const ADVariableValue *> _group_scalar_fluxes;
+  // The one-group reaction rates of all isotopes which form the current isotope under neutron
+  // bombardment (see NuclideReactionRateMaterial).
+  std::vector<const ADMaterialProperty<std::vector<Real>> *> _parent_reaction_rates;
 
   // A vector to store all of the isotope number densities which form the
   // current isotope under neutron bombardment.
   std::vector<const ADVariableValue *> _isotope_fractions;
 
-  // A vector to store all of the group activation cross-sections.
-  std::vector<Real> _sigma_a_g;
+  // The branching factor of each parent reaction rate.
+  const std::vector<Real> _branching_factors;
 }; // class ADMassFractionNuclideActivation
@@ -12,12 +12,6 @@ public:
 protected:
   virtual ADReal computeQpResidual() override;
 
-  // Number of energy groups.
-  const unsigned int _num_groups;
-
-  // A vector to store all of the group scalar fluxes.
-  std::vector<const ADVariableValue *> _group_scalar_fluxes;
-
-  // A vector to store all of the group absorption cross-sections.
-  std::vector<Real> _sigma_a_g;
+  // The one-group reaction rates of this isotope (see NuclideReactionRateMaterial).
+  const ADMaterialProperty<std::vector<Real>> & _reaction_rates;
 }; // class ADMassFractionNuclideDepletion
@@ -15,5 +15,5 @@ protected:
   // g
   const unsigned int _group_index;
 
-  const ADMaterialProperty<std::vector<Real>> & _inv_v_g;
+  const MaterialProperty<std::vector<Real>> & _inv_v_g;
 }; // class ADParticleTimeDerivative
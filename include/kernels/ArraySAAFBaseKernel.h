@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ArraySNBaseKernel.h"
+
+// A class which provides common functionality to array discrete ordinates kernels which have been
+// stabilized with the self-adjoint angular flux method.
+class ArraySAAFBaseKernel : public ArraySNBaseKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySAAFBaseKernel(const InputParameters & parameters);
+
+protected:
+  // Computes $\phi_{j} + \tau_{g}\vec{\nabla}\phi_{j}\cdot\hat{\Omega}_{n}$ for all ordinates at
+  // the current quadrature point.
+  const RealEigenVector & computeQpTests();
+
+  // Computes $\hat{\Omega}_{n}\cdot\vec{\nabla}\phi_{j}$ for all ordinates at the current
+  // quadrature point.
+  RealEigenVector computeQpOmegaGradPhi();
+
+  // g
+  const unsigned int _group_index;
+
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
+
+  // SAAF stabilization parameters.
+  const MaterialProperty<std::vector<Real>> & _saaf_tau;
+
+  // Work vector for the stabilized test functions.
+  RealEigenVector _qp_tests;
+}; // class ArraySAAFBaseKernel
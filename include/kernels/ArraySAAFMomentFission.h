@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ArraySAAFBaseKernel.h"
+
+// A class to compute the residual contribution from fission for all ordinates of a group in the
+// neutron-specific form of the discrete ordinates radiation transport equation. This kernel
+// operates on scalar flux moments and only assembles the within-group Jacobian.
+class ArraySAAFMomentFission : public ArraySAAFBaseKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySAAFMomentFission(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  // Computes the within-group fission coefficient at the current quadrature point.
+  Real computeQpSelfFission();
+
+  // Total number of spectral energy groups.
+  const unsigned int _num_groups;
+
+  // The required scalar fluxes.
+  std::vector<const VariableValue *> _group_scalar_fluxes;
+
+  // The neutron production cross-sections.
+  const MaterialProperty<std::vector<Real>> & _nu_sigma_f_g;
+  // The fission production spectra.
+  const MaterialProperty<std::vector<Real>> & _chi_g;
+}; // class ArraySAAFMomentFission
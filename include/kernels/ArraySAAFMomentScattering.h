@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ArraySAAFBaseKernel.h"
+
+#include "ScatteringCrossSections.h"
+
+// A class which computes the scattering source for all ordinates of a group in the SAAF discrete
+// ordinates transport equation. The scattering source is evaluated from the flux moments of all
+// groups, and the full within-group ordinate-to-ordinate Jacobian is assembled since every ordinate
+// of the group lives in the same array variable.
+class ArraySAAFMomentScattering : public ArraySAAFBaseKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySAAFMomentScattering(const InputParameters & parameters);
+
+protected:
+  virtual void precalculateResidual() override;
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+
+  virtual void initQpJacobian() override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  virtual void initQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  // Computes the within-group scattering operator which maps the angular fluxes of the current
+  // group to their scattering source at the current quadrature point.
+  void computeQpSelfScattering();
+
+  // Total number of spectral energy groups.
+  const unsigned int _num_groups;
+  // The maximum anisotropy of the flux moments provided.
+  const unsigned int _max_anisotropy;
+  // Total number of flux moments per particle energy group.
+  unsigned int _num_moments_per_group;
+
+  // The flux moments.
+  std::vector<const VariableValue *> _group_flux_moments;
+
+  // The scattering cross-sections of the medium and their compressed list of nonzero g' -> g
+  // transfers. See ScatteringCrossSections for the expected ordering.
+  const MaterialProperty<const ScatteringCrossSections *> & _scattering_xs;
+
+  // (2l + 1) / (4 pi) for each moment, including the symmetry factor of the quadrature set.
+  RealEigenVector _moment_coefficients;
+
+  // Work storage for the current element: the scattering source moments (moments x quadrature
+  // points) and their expansion onto all ordinates (ordinates x quadrature points).
+  RealEigenMatrix _element_moment_sources;
+  RealEigenMatrix _element_scattering_sources;
+  // Work storage for the current quadrature point.
+  RealEigenMatrix _qp_self_scattering;
+}; // class ArraySAAFMomentScattering
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "ArraySAAFBaseKernel.h"
+
+class ArraySAAFStreaming : public ArraySAAFBaseKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySAAFStreaming(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+}; // class ArraySAAFStreaming
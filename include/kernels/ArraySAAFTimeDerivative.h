@@ -0,0 +1,21 @@
+#pragma once
+
+#include "ArraySAAFBaseKernel.h"
+
+class ArraySAAFTimeDerivative : public ArraySAAFBaseKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySAAFTimeDerivative(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  // Holds the time derivatives at the quadrature points.
+  const ArrayVariableValue & _u_dot;
+  const VariableValue & _du_dot_du;
+
+  const MaterialProperty<std::vector<Real>> & _inv_v_g;
+}; // ArraySAAFTimeDerivative
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ArraySAAFBaseKernel.h"
+
+// A class which implements the anisotropic particle source term for a volumetric source in the SAAF
+// particle transport equation for all ordinates of a group.
+class ArraySAAFVolumeSource : public ArraySAAFBaseKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySAAFVolumeSource(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+
+  // Number of spectral energy groups (G).
+  const unsigned int _num_groups;
+
+  // The source moments for all groups. See SAAFVolumeSource for the expected ordering.
+  const std::vector<Real> _source_moments;
+  // Degree of anisotropy (Legendre polynomial order L) for the material source.
+  const unsigned int _anisotropy;
+
+  // The pre-computed angular source for every ordinate in the current group.
+  RealEigenVector _ordinate_source;
+}; // class ArraySAAFVolumeSource
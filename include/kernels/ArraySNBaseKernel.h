@@ -0,0 +1,25 @@
+#pragma once
+
+#include "ArrayKernel.h"
+
+#include "AQProvider.h"
+
+// A base class for all array neutron transport kernels. Array kernels operate on a single array
+// variable which stores every discrete ordinate of an energy group as a component, such that
+// component n of the variable is the angular flux along the quadrature direction n.
+class ArraySNBaseKernel : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySNBaseKernel(const InputParameters & parameters);
+
+protected:
+  const AQProvider & _aq;
+  Real _symmetry_factor;
+
+  // The quadrature directions stored row-wise (Omega_{n} = _omega.row(n)) and the quadrature
+  // weights. Used to evaluate all ordinates of the group at once.
+  RealVectorArrayValue _omega;
+  RealEigenVector _weights;
+}; // class ArraySNBaseKernel
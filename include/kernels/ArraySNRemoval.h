@@ -0,0 +1,20 @@
+#pragma once
+
+#include "ArrayKernel.h"
+
+class ArraySNRemoval : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArraySNRemoval(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  // g
+  const unsigned int _group_index;
+
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
+}; // class ArraySNRemoval
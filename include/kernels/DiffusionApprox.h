@@ -18,5 +18,5 @@ protected:
   // g
   const unsigned int _group_index;
 
-  const ADMaterialProperty<std::vector<Real>> & _diffusion_g;
+  const MaterialProperty<std::vector<Real>> & _diffusion_g;
 }; // class DiffusionApprox
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Kernel.h"
+
+#include "ScatteringCrossSections.h"
+
+// A class which computes the source of the diffusion synthetic acceleration (DSA) correction
+// equation. The source is the scattering of the change in the scalar fluxes over the last source
+// iteration for all groups which were lagged in that iteration.
+class DiffusionDSASource : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  DiffusionDSASource(const InputParameters & parameters);
+
+protected:
+  virtual void precalculateResidual() override;
+  virtual Real computeQpResidual() override;
+
+  // The current group (g) and the number of spectral energy groups (G).
+  const unsigned int _group_index;
+  const unsigned int _num_groups;
+
+  // Whether groups g' < g were swept with the current scalar fluxes (block Gauss-Seidel).
+  const bool _gauss_seidel;
+
+  // The lagged scalar fluxes, ordered by energy group.
+  std::vector<const VariableValue *> _group_scalar_fluxes;
+  // The uncollided scalar fluxes which have been added to the lagged scalar fluxes.
+  std::vector<const VariableValue *> _group_uncollided_fluxes;
+
+  // The current flux moments of all groups, provided by SNFluxMomentMaterial.
+  const MaterialProperty<std::vector<Real>> & _flux_moments;
+
+  // The scattering cross-sections of the medium. Only the 0th degree moments are used.
+  const MaterialProperty<const ScatteringCrossSections *> & _scattering_xs;
+
+  // The DSA source at each quadrature point of the current element.
+  std::vector<Real> _qp_source;
+}; // class DiffusionDSASource
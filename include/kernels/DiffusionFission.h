@@ -23,7 +23,7 @@ protected:
   std::vector<const VariableValue *> _group_scalar_fluxes;
 
   // The neutron production cross-sections.
-  const ADMaterialProperty<std::vector<Real>> & _nu_sigma_f_g;
+  const MaterialProperty<std::vector<Real>> & _nu_sigma_f_g;
   // The fission production spectra.
-  const ADMaterialProperty<std::vector<Real>> & _chi_g;
+  const MaterialProperty<std::vector<Real>> & _chi_g;
 }; // class ADDiffusionFission
@@ -22,7 +22,7 @@ protected:
 
   // A vector containing the fission heating cross-section. Roughly equivalent to \kappa_{g} *
   // \Sigma_{f,g}.
-  const ADMaterialProperty<std::vector<Real>> & _kappa_fission;
+  const MaterialProperty<std::vector<Real>> & _kappa_fission;
 
   // A factor to scale the fission power by.
   const Real _scaling_factor;
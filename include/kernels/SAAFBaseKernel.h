@@ -21,8 +21,8 @@ protected:
   // g
   const unsigned int _group_index;
 
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
 
   // SAAF stabilization parameters.
-  const ADMaterialProperty<std::vector<Real>> & _saaf_tau;
+  const MaterialProperty<std::vector<Real>> & _saaf_tau;
 }; // class SAAFBaseKernel
@@ -16,14 +16,19 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
 
+  // Fetch the scalar flux of group g at the current quadrature point.
+  Real scalarFlux(unsigned int g);
+
   // Total number of spectral energy groups.
   const unsigned int _num_groups;
 
   // The required scalar fluxes.
   std::vector<const VariableValue *> _group_scalar_fluxes;
+  // The cached flux moments of all groups, used when the scalar fluxes are not coupled.
+  const MaterialProperty<std::vector<Real>> * _flux_moments = nullptr;
 
   // The neutron production cross-sections.
-  const ADMaterialProperty<std::vector<Real>> & _nu_sigma_f_g;
+  const MaterialProperty<std::vector<Real>> & _nu_sigma_f_g;
   // The fission production spectra.
-  const ADMaterialProperty<std::vector<Real>> & _chi_g;
+  const MaterialProperty<std::vector<Real>> & _chi_g;
 }; // class SAAFMomentFission
@@ -2,6 +2,8 @@
 
 #include "SAAFBaseKernel.h"
 
+#include "ScatteringCrossSections.h"
+
 class SAAFScattering : public SAAFBaseKernel
 {
 public:
@@ -10,59 +12,55 @@ public:
   SAAFScattering(const InputParameters & parameters);
 
 protected:
+  virtual void precalculateResidual() override;
+  virtual void precalculateJacobian() override;
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  Real computeFluxMoment(unsigned int g_prime, unsigned int sh_offset);
+  // Computes the moment coefficients (2l + 1) / (4 pi) SigmaS_{g', g, l} of the g' -> g transfer at
+  // quadrature point qp in _transfer_coefficients. Returns false if the transfer is zero.
+  bool computeTransferCoefficients(unsigned int qp, unsigned int g_prime);
+  // Computes the derivative of the scattering source of the current ordinate with respect to
+  // Psi_{g', n'} at every quadrature point of the element.
+  void computeScatteringJacobian(unsigned int g_prime, unsigned int n_prime);
 
   const unsigned int _num_groups;     // G
   const unsigned int _max_anisotropy; // L
-  unsigned int _num_dir_sh;           // Number of spherical harmonics evaluations per direction.
+  unsigned int _num_moments_per_group;
 
   /*
-   * We assume that the vector of flux ordinates is stored in order of group
-   * first, direction second. An example for 2 energy groups (G = 2) and a
-   * quadrature set with 2 elements (N = 2) is given below:
+   * Maps the variable number of every coupled flux ordinate to its group and
+   * direction (g, n). The coupled ordinates are stored in order of group first,
+   * direction second. An example for 2 energy groups (G = 2) and a quadrature
+   * set with 2 elements (N = 2) is given below:
    *
-   * The flux ordinates are indexed as Psi_{g, n}:
-   * _group_flux_ordinates[0] = Psi_{1, 1}
-   * _group_flux_ordinates[0] = Psi_{1, 2}
-   * _group_flux_ordinates[0] = Psi_{2, 1}
-   * _group_flux_ordinates[0] = Psi_{2, 2}
+   * group_flux_ordinates = 'Psi_{1, 1} Psi_{1, 2} Psi_{2, 1} Psi_{2, 2}'
+   * _jvar_map[number of Psi_{1, 2}] = (0, 1)
+   * _jvar_map[number of Psi_{2, 1}] = (1, 0)
    */
   std::map<unsigned int, std::pair<unsigned int, unsigned int>> _jvar_map;
-  std::vector<const VariableValue *> _group_flux_ordinates;
 
-  /*
-   * We assume that the vector of scattering cross-sections is stored in the
-   * order of initial group first, final group second, and Legendre polynomial
-   * third. An example for two energy groups (G = 2) and an anisotropy of 2
-   * (Legendre polynomial order L = 2) is given below.
-   *
-   * The scattering cross-sections are indexed as SigmaS_{g', g, l}:
-   * _sigma_s_g_prime_g_l[_qp][0] = SigmaS_{1, 1, 0}
-   * _sigma_s_g_prime_g_l[_qp][1] = SigmaS_{1, 1, 1}
-   * _sigma_s_g_prime_g_l[_qp][2] = SigmaS_{1, 1, 2}
-   * _sigma_s_g_prime_g_l[_qp][3] = SigmaS_{1, 2, 0}
-   * _sigma_s_g_prime_g_l[_qp][4] = SigmaS_{1, 2, 1}
-   * _sigma_s_g_prime_g_l[_qp][5] = SigmaS_{1, 2, 2}
-   * _sigma_s_g_prime_g_l[_qp][6] = SigmaS_{2, 1, 0}
-   * _sigma_s_g_prime_g_l[_qp][7] = SigmaS_{2, 1, 1}
-   * _sigma_s_g_prime_g_l[_qp][8] = SigmaS_{2, 1, 2}
-   * _sigma_s_g_prime_g_l[_qp][9] = SigmaS_{2, 2, 0}
-   * _sigma_s_g_prime_g_l[_qp][10] = SigmaS_{2, 2, 1}
-   * _sigma_s_g_prime_g_l[_qp][11] = SigmaS_{2, 2, 2}
-   *
-   * This is a flattening of the scattering matrix to preserve coherency in memory.
-   * The material providing the cross-sections moments is expected to format them
-   * according to this arrangement.
-   */
-  const ADMaterialProperty<std::vector<Real>> & _sigma_s_g_prime_g_l;
-  // Degree of anisotropy (Legendre polynomial order L) for the medium.
-  const MaterialProperty<unsigned int> & _anisotropy;
+  // The flux moments of all groups, computed once per quadrature point by SNFluxMomentMaterial.
+  const MaterialProperty<std::vector<Real>> & _flux_moments;
+
+  // The scattering cross-sections of the medium and their compressed list of nonzero g' -> g
+  // transfers. See ScatteringCrossSections for the expected ordering.
+  const MaterialProperty<const ScatteringCrossSections *> & _scattering_xs;
+
+  // The row of the moment-to-discrete operator for the current ordinate (Y_{l,m}(Omega_{n})).
+  RealEigenVector _y_l_m;
+  // (2l + 1) / (4 pi) for each moment, including the symmetry factor of the quadrature set.
+  RealEigenVector _moment_coefficients;
+  // Work vector for the moment coefficients of a single g' -> g transfer.
+  RealEigenVector _transfer_coefficients;
 
-  // Storage for the pre-computed spherical harmonics coefficients (Y_{l,m,n}).
-  // They are stored in the following order: n -> l -> m.
-  std::vector<Real> _y_l_m_n;
+  // The scattering source moments of the current group at each quadrature point of the element,
+  // stored as a (moments x quadrature points) matrix.
+  RealEigenMatrix _element_moment_sources;
+  // The scattering source for the current ordinate at each quadrature point of the element.
+  RealEigenVector _qp_scattering_source;
+  // The scattering Jacobian for the current coupled ordinate at each quadrature point.
+  std::vector<Real> _qp_scattering_jacobian;
 }; // class SAAFScattering
@@ -17,5 +17,5 @@ protected:
   const VariableValue & _u_dot;
   const VariableValue & _du_dot_du;
 
-  const ADMaterialProperty<std::vector<Real>> & _inv_v_g;
+  const MaterialProperty<std::vector<Real>> & _inv_v_g;
 }; // ADSAAFTimeDerivative
@@ -51,7 +51,11 @@ protected:
   // Degree of anisotropy (Legendre polynomial order L) for the material source.
   const unsigned int _anisotropy;
 
-  // Storage for the pre-computed spherical harmonics coefficients (Y_{l,m,n}).
-  // They are stored in the following order: l -> m.
-  std::vector<Real> _y_l_m;
+  // Evaluates the angular source of the current ordinate for the dimensionality P.
+  template <ProblemType P>
+  Real computeOrdinateSource() const;
+
+  // The angular source of the current ordinate. The source moments are constant, and so the
+  // expansion is evaluated once at construction.
+  Real _ordinate_source;
 }; // class ADSAAFVolumeSource
@@ -22,7 +22,7 @@ protected:
   // g
   const unsigned int _group_index;
   // Total cross-section.
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
   // SAAF stabilization parameters.
-  const ADMaterialProperty<std::vector<Real>> & _saaf_tau;
+  const MaterialProperty<std::vector<Real>> & _saaf_tau;
 }; // class SASFAdvection
@@ -16,5 +16,5 @@ protected:
   // g
   const unsigned int _group_index;
 
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
 }; // class ADSNRemoval
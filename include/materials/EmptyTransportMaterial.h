@@ -3,6 +3,7 @@
 #include "Material.h"
 
 #include "GnatBase.h"
+#include "ScatteringCrossSections.h"
 
 class EmptyTransportMaterial : public Material
 {
@@ -14,6 +15,12 @@ public:
 protected:
   virtual void computeQpProperties() override;
 
+  // Refresh _h_min at the first qp of every element. Returns true if it was recomputed.
+  bool updateElementSize();
+  // Compute the SAAF stabilization parameters for the group total cross-sections sigma_t_g using
+  // the element size _h_min.
+  void computeSAAFTau(const std::vector<Real> & sigma_t_g, std::vector<Real> & saaf_tau) const;
+
   // Speed of light in cm s^{-1}.
   static constexpr Real _c_cm = 2.99792458e10;
   static constexpr Real _inv_c_cm = 3.335640952e-11;
@@ -34,26 +41,38 @@ protected:
   const bool _has_heating;
 
   // Material properties that transport materials are expected to provide.
-  ADMaterialProperty<std::vector<Real>> & _mat_inv_v_g;
-  ADMaterialProperty<std::vector<Real>> & _mat_sigma_t_g;
-  ADMaterialProperty<std::vector<Real>> & _mat_surface_source;
-  ADMaterialProperty<std::vector<Real>> & _mat_sigma_s_g_prime_g_l;
-  MaterialProperty<unsigned int> & _mat_anisotropy;
-  ADMaterialProperty<std::vector<Real>> & _mat_source_moments;
+  MaterialProperty<std::vector<Real>> & _mat_inv_v_g;
+  MaterialProperty<std::vector<Real>> & _mat_sigma_t_g;
+  MaterialProperty<std::vector<Real>> & _mat_surface_source;
+  MaterialProperty<std::vector<Real>> & _mat_source_moments;
   MaterialProperty<unsigned int> & _mat_src_anisotropy;
 
+  // The scattering cross-sections and their compressed structure. Points to _scattering_xs unless
+  // the cross-sections vary within the element.
+  MaterialProperty<const ScatteringCrossSections *> & _mat_scattering_xs;
+
   // Material properties for diffusion schemes.
-  ADMaterialProperty<std::vector<Real>> * _mat_sigma_r_g;
-  ADMaterialProperty<std::vector<Real>> * _mat_diffusion_g;
+  MaterialProperty<std::vector<Real>> * _mat_sigma_r_g;
+  MaterialProperty<std::vector<Real>> * _mat_diffusion_g;
 
   // Material properties for fission.
-  ADMaterialProperty<std::vector<Real>> * _mat_nu_sigma_f_g;
-  ADMaterialProperty<std::vector<Real>> * _mat_chi_f_g;
+  MaterialProperty<std::vector<Real>> * _mat_nu_sigma_f_g;
+  MaterialProperty<std::vector<Real>> * _mat_chi_f_g;
 
-  ADMaterialProperty<std::vector<Real>> * _mat_heating_g;
+  MaterialProperty<std::vector<Real>> * _mat_heating_g;
 
   // SAAF stabilization parameters.
-  ADMaterialProperty<std::vector<Real>> * _mat_saaf_tau;
+  MaterialProperty<std::vector<Real>> * _mat_saaf_tau;
   Real _saaf_eta;
   Real _saaf_c;
+
+  // The minimum size of the current element and the element it was computed for.
+  Real _h_min;
+  const Elem * _h_min_elem;
+  // SAAF stabilization parameters of the current element for block-constant cross-sections.
+  std::vector<Real> _elem_saaf_tau;
+
+  // The scattering record shared by all quadrature points of the block. Materials with constant
+  // cross-sections fill and compress it once. No scattering by default.
+  ScatteringCrossSections _scattering_xs;
 }; // class EmptyTransportMaterial
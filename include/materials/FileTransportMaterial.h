@@ -2,6 +2,7 @@
 
 #include "GnatBase.h"
 #include "EmptyTransportMaterial.h"
+#include "MGXSLibrary.h"
 
 class FileTransportMaterial : public EmptyTransportMaterial
 {
@@ -13,23 +14,12 @@ public:
 protected:
   virtual void computeQpProperties() override;
 
-  // A helper function to turn a string vector of cross-sections deliminated with a ' ' into a
-  // vector of numerics.
-  static void parseToVector(const std::string & string_rep, std::vector<Real> & real_rep);
-  void parseXMLMacroXS();
+  // Copy the cross-sections of this material out of the shared cross-section library.
+  void loadLibraryXS();
 
   // Cross-section information.
-  enum class XSUnits
-  {
-    InvCm = 0u
-  } _xs_units;
-  enum class EnergyUnits
-  {
-    eV = 0u,
-    keV = 1u,
-    MeV = 2u
-  } _energy_units;
-  std::vector<Real> _group_bounds;
+  MGXSLibrary::XSUnits _xs_units;
+  MGXSLibrary::EnergyUnits _energy_units;
 
   // The sum of all isotopic material properties are the actual properties provided to the transport
   // solver.
@@ -75,6 +65,5 @@ protected:
   unsigned int _max_source_moments;
   bool _has_volumetric_source;
 
-  const std::string _file_name;
   const std::string & _source_material_id;
 }; // class FileTransportMaterial
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Material.h"
+
+// Computes the one-group neutron reaction rates \sum_{g = 1}^{G}\sigma_{r,g,i}\Phi_{g} of every
+// reaction r of every nuclide i once per quadrature point. The rates of each nuclide are stored in
+// the property '<system>_reaction_rates_<nuclide>' (one entry per reaction) such that the
+// depletion and activation kernels of all nuclides share them instead of collapsing the fluxes
+// themselves.
+class NuclideReactionRateMaterial : public Material
+{
+public:
+  static InputParameters validParams();
+
+  NuclideReactionRateMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  // Number of energy groups.
+  const unsigned int _num_groups;
+
+  // A vector to store all of the group scalar fluxes.
+  std::vector<const ADVariableValue *> _group_scalar_fluxes;
+
+  // The number of reactions of each nuclide.
+  const std::vector<unsigned int> & _num_reactions;
+  // The microscopic cross-sections, flat packed as nuclide -> reaction -> group.
+  const std::vector<Real> & _sigma_r_g;
+
+  // The reaction rates of each nuclide.
+  std::vector<ADMaterialProperty<std::vector<Real>> *> _reaction_rates;
+
+  // The group scalar fluxes at the current quadrature point.
+  std::vector<ADReal> _qp_fluxes;
+}; // class NuclideReactionRateMaterial
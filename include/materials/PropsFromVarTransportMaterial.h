@@ -2,6 +2,8 @@
 
 #include "EmptyTransportMaterial.h"
 
+#include <deque>
+
 class PropsFromVarTransportMaterial : public EmptyTransportMaterial
 {
 public:
@@ -22,6 +24,10 @@ protected:
   const unsigned int _anisotropy;
   const unsigned int _max_moments;
 
+  // The scattering records of each qp. A deque is used such that growing the container does not
+  // invalidate the pointers already published at earlier quadrature points.
+  std::deque<ScatteringCrossSections> _qp_scattering_xs;
+
   // Fission neutron production cross sections for each group.
   std::vector<const VariableValue *> _nu_sigma_f_g;
 
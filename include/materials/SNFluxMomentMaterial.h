@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Material.h"
+
+#include "AQProvider.h"
+
+// A material which computes the angular flux moments of all groups once per quadrature point. The
+// moments are shared by every discrete ordinate kernel on the element, such that the cost of
+// evaluating the scattering source scales linearly with the number of ordinates.
+class SNFluxMomentMaterial : public Material
+{
+public:
+  static InputParameters validParams();
+
+  SNFluxMomentMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  const AQProvider & _aq;
+
+  // Total number of spectral energy groups.
+  const unsigned int _num_groups;
+  // The maximum anisotropy of the flux moments.
+  const unsigned int _max_anisotropy;
+  // Total number of flux moments per particle energy group.
+  unsigned int _num_moments_per_group;
+
+  // The flux ordinates, stored in order of group first and direction second (Psi_{g, n}).
+  std::vector<const VariableValue *> _group_flux_ordinates;
+
+  // Work storage for the flux ordinates of all groups at the current quadrature point, stored as
+  // an ordinates x groups matrix.
+  RealEigenMatrix _qp_ordinates;
+
+  /*
+   * The flux moments are stored in order of group first, then moment indices (l -> m). As an
+   * example for 2 energy groups (G = 2) in 1D with L = 1:
+   * _flux_moments[_qp][0] = Phi_{1, 0, 0}
+   * _flux_moments[_qp][1] = Phi_{1, 1, 0}
+   * _flux_moments[_qp][2] = Phi_{2, 0, 0}
+   * _flux_moments[_qp][3] = Phi_{2, 1, 0}
+   */
+  MaterialProperty<std::vector<Real>> & _flux_moments;
+}; // class SNFluxMomentMaterial
@@ -21,5 +21,5 @@ protected:
 
   // A vector containing the fission heating cross-section. Roughly equivalent to \kappa_{g} *
   // \Sigma_{f,g}.
-  const ADMaterialProperty<std::vector<Real>> & _kappa_fission;
+  const MaterialProperty<std::vector<Real>> & _kappa_fission;
 }; // class FissionPowerPostProcessor
@@ -20,5 +20,5 @@ protected:
   std::vector<const VariableValue *> _group_scalar_fluxes;
 
   // The neutron production cross-sections.
-  const ADMaterialProperty<std::vector<Real>> & _nu_sigma_f_g;
+  const MaterialProperty<std::vector<Real>> & _nu_sigma_f_g;
 }; // class FissionRRPostprocessor
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+// A class which computes the relative L2 change in the group scalar fluxes between two source
+// iterations. The scalar fluxes of the current iterate are provided by SNFluxMomentMaterial, while
+// the lagged scalar fluxes are the auxiliary variables used to build the scattering source.
+class SourceIterationChange : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  SourceIterationChange(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  // Total number of spectral energy groups.
+  const unsigned int _num_groups;
+  // Whether a convergence report should be printed after every source iteration.
+  const bool _print_report;
+
+  // The lagged scalar fluxes.
+  std::vector<const VariableValue *> _group_scalar_fluxes;
+  // The uncollided scalar fluxes which have been added to the lagged scalar fluxes.
+  std::vector<const VariableValue *> _group_uncollided_fluxes;
+
+  // The current flux moments of all groups.
+  const MaterialProperty<std::vector<Real>> & _flux_moments;
+
+  // The integrated squared change and the integrated squared scalar flux for each group.
+  std::vector<Real> _group_diff;
+  std::vector<Real> _group_norm;
+
+  // The relative change over all groups.
+  Real _change;
+
+  // Source iteration counter, reset at the start of each time step.
+  unsigned int _iteration;
+  int _last_t_step;
+}; // class SourceIterationChange
@@ -19,5 +19,5 @@ protected:
   // The required scalar fluxes.
   std::vector<const VariableValue *> _group_scalar_fluxes;
 
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
 }; // class TotalRRPostprocessor
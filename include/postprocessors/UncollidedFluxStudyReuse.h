@@ -0,0 +1,24 @@
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class UncollidedFluxRayStudy;
+
+// Reports the number of executions of an UncollidedFluxRayStudy which reused the previous
+// uncollided flux moments (hits) or computed them (misses) when skipping unchanged executions.
+class UncollidedFluxStudyReuse : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  UncollidedFluxStudyReuse(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual Real getValue() const override;
+
+protected:
+  const UncollidedFluxRayStudy & _study;
+
+  const enum class Statistic { Hits = 0u, Misses = 1u } _statistic;
+}; // class UncollidedFluxStudyReuse
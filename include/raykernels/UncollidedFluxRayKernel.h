@@ -5,6 +5,10 @@
 #include "MooseVariableFE.h"
 #include "MooseVariableInterface.h"
 
+#include "GnatBase.h"
+
+#include <unordered_map>
+
 class AuxiliarySystem;
 
 /*
@@ -33,10 +37,43 @@ public:
    */
   MooseVariableFE<RealEigenVector> & variable() { return _var; }
 
+  // Accumulates the uncollided flux moments of the current element into the buffer of this thread.
   void addValue(const RealEigenVector & value);
+  // Adds the accumulated moments into the aux solution and clears the buffer. This must be called
+  // by the study for every thread once the rays have been traced.
+  void addAccumulatedValues();
 
   void onSegment() override final;
 
+  // The ray geometry recorded for UncollidedFluxRayStudy when caching ray segments. Segments store
+  // the element and length of every traced segment. Terminations store the element the uncollided
+  // flux was added to, along with the per-group coefficients (source intensity, spatial weights,
+  // Green's function and element volume) and the spherical harmonics of the ray direction, such
+  // that the uncollided flux can be re-evaluated from the optical depths without tracing.
+  struct CachedSegment
+  {
+    RayID _ray;
+    const Elem * _elem;
+    Real _length;
+  };
+  struct CachedTermination
+  {
+    RayID _ray;
+    dof_id_type _dof;
+    const Elem * _elem;
+    Real _distance;
+    bool _in_element;
+  };
+  const std::vector<CachedSegment> & cachedSegments() const { return _cached_segments; }
+  const std::vector<CachedTermination> & cachedTerminations() const { return _cached_terminations; }
+  // [termination][group].
+  const std::vector<Real> & cachedCoefficients() const { return _cached_coefficients; }
+  // [termination][moment].
+  const std::vector<Real> & cachedHarmonics() const { return _cached_harmonics; }
+  void clearCache();
+
+  unsigned int numGroupMoments() const { return _num_group_moments; }
+
 protected:
   static void cartesianToSpherical(const RealVectorValue & direction, Real & mu, Real & omega);
 
@@ -47,9 +84,26 @@ protected:
   // - The source element is equal to the target element, and so we need to remove the Green's
   // function to avoid explosions up to infinity.
   // - The source is not in the target element and so we can use the Green's function.
+  // Both are instantiated for the moment ordering of the problem dimensionality, selected once at
+  // construction.
+  template <ProblemType P>
   void computeUncollidedFluxSourceIsTarget();
+  template <ProblemType P>
   void computeUncollidedFluxSourceNotTarget();
 
+  // Evaluates the spherical harmonics of the current ray direction in the moment order of the
+  // problem.
+  template <ProblemType P>
+  void evaluateMomentHarmonics();
+  // Projects the group factors onto the moment harmonics and accumulates the result.
+  void addProjectedValue();
+
+  // Records the current ray termination when caching ray segments.
+  void cacheTermination(bool in_element, Real geometry);
+
+  void (UncollidedFluxRayKernel::*_source_is_target)();
+  void (UncollidedFluxRayKernel::*_source_not_target)();
+
   // The aux system
   AuxiliarySystem & _aux;
 
@@ -70,9 +124,28 @@ protected:
   const unsigned int _max_eval_anisotropy;
   const unsigned int _num_group_moments;
   // The total cross-section.
-  const ADMaterialProperty<std::vector<Real>> & _sigma_t_g;
+  const MaterialProperty<std::vector<Real>> & _sigma_t_g;
+
+  // Work storage for the spherical harmonics of the current ray direction.
+  std::vector<Real> _y_l_m;
+  // The harmonics in moment order, the per-group attenuation and source factors, and their
+  // projection onto the group moments.
+  RealEigenVector _moment_harmonics;
+  RealEigenVector _group_factors;
+  RealEigenVector _projected;
+
+  // Whether the ray geometry should be recorded for UncollidedFluxRayStudy.
+  const bool _cache_segments;
 
 private:
-  /// Spin mutex object for adding values
-  static Threads::spin_mutex _add_value_mutex;
+  // The uncollided flux moments accumulated by this thread, indexed by the first dof of each
+  // element. Every thread owns a copy of this kernel, so no locking is required when tracing.
+  std::unordered_map<dof_id_type, RealEigenVector> _accumulated_values;
+  std::vector<numeric_index_type> _add_dofs;
+  std::vector<Real> _add_values;
+
+  std::vector<CachedSegment> _cached_segments;
+  std::vector<CachedTermination> _cached_terminations;
+  std::vector<Real> _cached_coefficients;
+  std::vector<Real> _cached_harmonics;
 }; // class UncollidedFluxRayKernel
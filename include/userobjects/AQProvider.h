@@ -35,6 +35,40 @@ public:
   MajorAxis getAxis() const { return _aq->getAxis(); }
   ProblemType getProblemType() const { return _aq->getProblemType(); }
 
+  // Evaluates the real spherical harmonics up to a degree of max_anisotropy for all quadrature
+  // directions. Row n of y_l_m contains the harmonics for ordinate n, ordered l -> m following the
+  // moment ordering of the current problem dimensionality. The degree l of each column is returned
+  // in moment_degrees.
+  void evaluateHarmonics(unsigned int max_anisotropy,
+                         RealEigenMatrix & y_l_m,
+                         std::vector<unsigned int> & moment_degrees) const;
+
+  // The maximum degree of anisotropy supported by the pre-computed moment operators.
+  unsigned int maxAnisotropy() const { return _max_anisotropy; }
+  // The number of flux moments per group up to (and including) a degree of max_anisotropy. Moments
+  // are ordered l -> m, such that the moments of a lower degree are the leading rows / columns of
+  // the moment operators below.
+  unsigned int numMoments(unsigned int max_anisotropy) const;
+  // The degree l of each moment.
+  const std::vector<unsigned int> & momentDegrees() const { return _moment_degrees; }
+  // The index of the moment Phi_{l,m} in the moment ordering of the problem dimensionality.
+  unsigned int momentIndex(unsigned int degree, int order) const;
+
+  // The pre-computed harmonics Y_{k}(Omega_{n}) of ordinate n, stored contiguously in the moment
+  // ordering. The table is laid out [ordinate][moment] with numMoments(maxAnisotropy()) moments
+  // per ordinate.
+  const Real * harmonics(unsigned int n) const
+  {
+    return _harmonics.data() + n * _moment_degrees.size();
+  }
+
+  // The discrete-to-moment operator D (moments x ordinates), D_{k, n} = w_{n}Y_{k}(Omega_{n}). The
+  // flux moments of a group are given by Phi = D Psi.
+  const RealEigenMatrix & discreteToMoment() const { return _discrete_to_moment; }
+  // The moment-to-discrete operator M (ordinates x moments), M_{n, k} = Y_{k}(Omega_{n}). An
+  // angular source is expanded onto the ordinates with Q = M S.
+  const RealEigenMatrix & momentToDiscrete() const { return _moment_to_discrete; }
+
 protected:
   enum class AQType
   {
@@ -42,4 +76,10 @@ protected:
   } _aq_type;
 
   std::unique_ptr<AngularQuadrature> _aq;
+
+  const unsigned int _max_anisotropy;
+  std::vector<unsigned int> _moment_degrees;
+  RealEigenMatrix _discrete_to_moment;
+  RealEigenMatrix _moment_to_discrete;
+  std::vector<Real> _harmonics;
 }; // class ThreadedGeneralUserObject
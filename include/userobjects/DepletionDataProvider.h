@@ -2,14 +2,19 @@
 
 #include "ThreadedGeneralUserObject.h"
 
+#include <map>
+
 #include "NuclearData.h"
 #include "Nuclide.h"
+#include "BurnupMatrix.h"
 
 // TODO: Radionuclide sources. Branching factor for a photon emission = prob / sum(prob).
 
 // A class which constructs and maintains depletion chains using user-provided depletion libraries.
 // Currently supports depletion xml files generated using OpenMC. Eventually aims to support the
 // isoXML file format used by Griffin.
+// When added by the DepletionLibraryAction the provider copies the chain (and cross-sections)
+// already parsed by the action instead of parsing the depletion file again.
 class DepletionDataProvider : public ThreadedGeneralUserObject
 {
 public:
@@ -38,15 +43,39 @@ public:
   // Nuclide depletion data.
   bool hasNuclide(const std::string & nuclide) const
   {
+    if (_burnup_matrix.hasNuclide(nuclide))
+      return true;
     if (nuclide.find('_') != std::string::npos)
-      return _nuclide_list.count(nuclide.substr(0u, nuclide.find('_'))) > 0u;
-    else
-      return _nuclide_list.count(nuclide) > 0u;
+      return _burnup_matrix.hasNuclide(nuclide.substr(0u, nuclide.find('_')));
+    return false;
   }
   const NuclearData::Nuclide & getNuclide(const std::string & nuclide) const
   {
     return _nuclide_list.at(nuclide);
   }
+  // The index of the nuclide in the burnup matrix and the tables below.
+  unsigned int getNuclideIndex(const std::string & nuclide) const
+  {
+    return _burnup_matrix.index(nuclide);
+  }
+  const NuclearData::Nuclide & getNuclide(unsigned int index) const
+  {
+    return *_indexed_nuclides[index];
+  }
+
+  // The burnup matrix of the entire depletion chain, with nuclides indexed in alphabetical order.
+  const NuclearData::BurnupMatrix & getBurnupMatrix() const { return _burnup_matrix; }
+  // Build the burnup matrix of a depletion system, indexing the nuclides in the provided order.
+  NuclearData::BurnupMatrix buildBurnupMatrix(const std::vector<std::string> & nuclides) const
+  {
+    return NuclearData::BurnupMatrix(_nuclide_list, nuclides, _burnup_matrix.numGroups());
+  }
+
+  // The group-wise decay emission rate (s^{-1}) of a particle for every nuclide, stored as a dense
+  // [nuclide][group] table. Tables are built once per particle and group structure, they should be
+  // requested during setup (object construction) and not on hot paths.
+  const std::vector<Real> & getEmissionRates(Particletype particle,
+                                             const std::vector<Real> & group_bounds) const;
 
 protected:
   void loadOpenMCXML();
@@ -58,8 +87,15 @@ protected:
   const std::string _xs_file;
 
   std::unordered_map<std::string, NuclearData::Nuclide> _nuclide_list;
+  // The nuclides ordered by their index in the burnup matrix.
+  std::vector<const NuclearData::Nuclide *> _indexed_nuclides;
+
+  // Emission rate tables, indexed by the particle and group structure.
+  mutable std::map<std::pair<Particletype, std::vector<Real>>, std::vector<Real>> _emission_rates;
 
   const std::vector<Real> _group_bounds;
 
   const bool _warnings;
+
+  NuclearData::BurnupMatrix _burnup_matrix;
 }; // class DepletionDataProvider.
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include "MGXSBinary.h"
+
+// A userobject which loads a macroscopic multigroup cross-section library once and provides
+// read-only access to the cross-sections of every domain (material) in the library. The object is
+// not threaded such that all transport materials (and their thread copies) share a single load.
+// XML libraries are parsed, binary libraries (see MGXSBinary) are memory-mapped and read in place.
+class MGXSLibrary : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  MGXSLibrary(const InputParameters & parameters);
+
+  virtual void execute() final {}
+  virtual void initialize() final {}
+  virtual void finalize() final {}
+
+  enum class XSUnits
+  {
+    InvCm = 0u
+  };
+  enum class EnergyUnits
+  {
+    eV = 0u,
+    keV = 1u,
+    MeV = 2u
+  };
+
+  // The cross-sections of a single domain in the library.
+  struct Domain
+  {
+    // Returns the cross-sections of the given type (ex: "total", "scatter") or an empty view if
+    // the library does not provide them.
+    MGXSBinary::ArrayView xs(const std::string & type) const;
+    // Copies the cross-sections of the given type into values.
+    void copy(const std::string & type, std::vector<Real> & values) const;
+
+    unsigned int _num_legendre;
+    std::unordered_map<std::string, MGXSBinary::ArrayView> _xs;
+  };
+
+  const std::string & fileName() const { return _file_name; }
+  unsigned int numGroups() const { return _num_groups; }
+  const std::vector<Real> & groupBounds() const { return _group_bounds; }
+  XSUnits xsUnits() const { return _xs_units; }
+  EnergyUnits energyUnits() const { return _energy_units; }
+
+  bool hasDomain(const std::string & id) const { return _domains.count(id) > 0u; }
+  const Domain & getDomain(const std::string & id) const;
+
+  // Resolves a library file name relative to the location of the input file.
+  static std::string resolveFileName(const MooseApp & app, const std::string & file_name);
+
+protected:
+  void loadXML();
+  void loadBinary();
+  void setUnits(const std::string & energy_units, const std::string & xs_units);
+  void addXS(const std::string & domain,
+             const std::string & type,
+             unsigned int num_legendre,
+             const MGXSBinary::ArrayView & values);
+
+  const std::string _file_name;
+
+  XSUnits _xs_units;
+  EnergyUnits _energy_units;
+  unsigned int _num_groups;
+  std::vector<Real> _group_bounds;
+
+  // All domains in the library, indexed by their ID. The domains view the storage below.
+  std::unordered_map<std::string, Domain> _domains;
+
+  // Storage for XML libraries.
+  MGXSBinary::Library _xml_library;
+  // The mapping of binary libraries.
+  MGXSBinary::MappedFile _binary_library;
+}; // class MGXSLibrary
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ElementUserObject.h"
+
+#include "BurnupMatrix.h"
+#include "CRAMSolver.h"
+
+class DepletionDataProvider;
+
+// Integrates the activation, depletion and decay of a mobile depletion system separately from mass
+// transport with Strang splitting. The nuclide mass fractions are advanced element-wise by half a
+// timestep at the beginning of each timestep (before the transport solve) and by half a timestep
+// at the end of each timestep (after the transport solve). The local depletion problem is solved
+// with CRAM, which is unconditionally stable such that the transport timestep is not limited by
+// the shortest half-life in the chain.
+class StrangSplitNuclideDepletion : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  StrangSplitNuclideDepletion(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  const std::vector<std::string> & _nuclides;
+
+  // The mass fraction variables of each nuclide and the atomic masses used to convert them into
+  // (relative) number densities.
+  std::vector<MooseVariableFieldBase *> _mass_fractions;
+  std::vector<Real> _atomic_masses;
+
+  std::vector<const VariableValue *> _group_scalar_fluxes;
+
+  const DepletionDataProvider * _data_provider;
+  std::unique_ptr<NuclearData::BurnupMatrix> _burnup_matrix;
+  std::unique_ptr<NuclearData::CRAMSolver> _solver;
+
+  // Whether the current execution is the half-step before the transport solve, and the last
+  // timestep this half-step was taken on. The half-step before the transport solve overwrites the
+  // old solution, so a copy of the untouched old solution is kept for repeated (cut) timesteps.
+  bool _before_transport;
+  int _last_split_step;
+  NumericVector<Number> * _untouched_old_solution;
+
+  // The depleted mass fractions of the elements on this thread. The solution vectors aren't thread
+  // safe, so they're only written once all threads have been joined.
+  std::vector<std::pair<dof_id_type, Real>> _depleted_values;
+
+  // Scratch storage for the element being depleted.
+  std::vector<Real> _group_fluxes;
+  std::vector<Real> _reaction_rates;
+  std::vector<Real> _values;
+  std::vector<Real> _number_densities;
+}; // class StrangSplitNuclideDepletion
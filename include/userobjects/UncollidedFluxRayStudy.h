@@ -2,6 +2,8 @@
 
 #include "RayTracingStudy.h"
 
+#include "UncollidedFluxRayKernel.h"
+
 // Angular quadrature sets.
 #include "GaussAngularQuadrature.h"
 
@@ -17,8 +19,32 @@ public:
 
   UncollidedFluxRayStudy(const InputParameters & parameters);
 
+  virtual void execute() override;
+  virtual void meshChanged() override;
+
+  // The number of executions which reused the previous uncollided flux moments (hits) and which
+  // computed them (misses) when skipping unchanged executions.
+  unsigned int numReuseHits() const { return _num_hits; }
+  unsigned int numReuseMisses() const { return _num_misses; }
+
 protected:
   virtual void generateRays() override;
+  // Reduces the thread-local uncollided flux moments of the ray kernels into the aux solution.
+  virtual void postExecuteStudy() override;
+
+  // Builds the ray segment cache from the geometry recorded by the ray kernels.
+  void buildRayCache();
+  // Re-evaluates the uncollided flux from the ray segment cache and the current cross-sections.
+  void executeCachedRays();
+
+  // Compares the sources, element-averaged total cross-sections and mesh to those of the previous
+  // execution, storing the current state.
+  bool inputsChanged();
+  // Zeroes the local uncollided flux moments before they're accumulated.
+  void zeroUncollidedMoments();
+  // Stores or restores the local uncollided flux moments.
+  void storeUncollidedMoments();
+  void restoreUncollidedMoments();
 
   static void cartesianToSpherical(const RealVectorValue & direction, Real & mu, Real & omega);
   Real computeSHSource(unsigned int source,
@@ -39,6 +65,8 @@ protected:
   // Radiation transport parameters.
   const unsigned int _num_groups;
   const Real _symmetry_factor;
+  // Work storage for the spherical harmonics of a ray direction.
+  std::vector<Real> _y_l_m;
 
   // Spatial quadrature rules.
   std::unique_ptr<FEBase> _volume_fe;
@@ -65,4 +93,44 @@ protected:
   const std::vector<SubdomainName> & _volume_source_blocks;
   const std::vector<std::vector<Real>> & _volume_source_moments;
   const std::vector<unsigned int> & _volume_source_anisotropy;
+  // The tolerance on the geometric and optical size of the volume source clusters sending a
+  // single ray to a target.
+  const Real _volume_ray_tolerance;
+
+  // Ray segment caching. The rays are traced once, after which the optical depths are evaluated as
+  // a sparse product of the cached segment lengths and the element-averaged total cross-sections.
+  // Segments are stored on the processor which traced them and compressed per ray. The partial
+  // optical depths of every ray are sent to the processor which owns the ray termination.
+  const bool _cache_segments;
+  bool _cache_valid;
+  unsigned int _num_group_moments;
+  const MooseVariableFieldBase * _total_xs_var;
+
+  // Change detection. The study is skipped if the inputs are unchanged since the last execution,
+  // in which case the stored uncollided flux moments are restored instead.
+  const bool _skip_unchanged;
+  // The array auxvariable which holds the uncollided flux moments.
+  const MooseVariableFieldBase * _uncollided_var;
+  bool _mesh_changed;
+  bool _has_fingerprint;
+  std::size_t _source_fingerprint;
+  std::vector<Real> _last_total_xs;
+  std::vector<Real> _current_total_xs;
+  std::vector<numeric_index_type> _uncollided_dofs;
+  std::vector<Real> _uncollided_values;
+  unsigned int _num_hits;
+  unsigned int _num_misses;
+
+  std::vector<unsigned int> _cached_segment_offsets;
+  std::vector<const Elem *> _cached_segment_elems;
+  std::vector<Real> _cached_segment_lengths;
+  // The cached rays (rows) whose optical depths are sent to each processor, in order.
+  std::map<processor_id_type, std::vector<unsigned int>> _cached_send_rows;
+
+  std::vector<UncollidedFluxRayKernel::CachedTermination> _cached_terminations;
+  std::vector<Real> _cached_coefficients;
+  std::vector<Real> _cached_harmonics;
+  // The terminations which receive the optical depths sent by each processor, in order.
+  std::map<processor_id_type, std::vector<unsigned int>> _cached_receive_terminations;
+  std::vector<Real> _cached_optical_depths;
 };
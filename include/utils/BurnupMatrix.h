@@ -0,0 +1,101 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Nuclide.h"
+
+namespace NuclearData
+{
+/*
+ * The burnup (transmutation and decay) matrix A of a set of nuclides, such that dN/dt = A N for
+ * the vector of nuclide number densities N. Nuclides are referred to by integer indices which
+ * follow the order of the nuclides the matrix was built with.
+ *
+ * The matrix is stored in compressed sparse row (CSR) form: the nonzero columns of row i are
+ * _columns[k] with _row_offsets[i] <= k < _row_offsets[i + 1], sorted in increasing order. Every
+ * row stores its diagonal. Decay contributions are constant and stored aligned with the columns.
+ * Reaction contributions depend on the neutron flux: the group-wise microscopic cross-sections of
+ * each reaction are stored as a contiguous [reaction][group] table, and the reaction entries map
+ * every one-group reaction rate onto the nonzeros it contributes to. A reaction with the branching
+ * factor b removes b sigma phi N_j from its parent j and adds the same amount to its target.
+ *
+ * Decays and reactions into nuclides outside of the matrix only contribute to the loss of their
+ * parent.
+ */
+class BurnupMatrix
+{
+public:
+  BurnupMatrix() : _num_groups(0u) {}
+  BurnupMatrix(const std::unordered_map<std::string, Nuclide> & chain,
+               const std::vector<std::string> & nuclides,
+               unsigned int num_groups);
+
+  unsigned int numNuclides() const { return _names.size(); }
+  unsigned int numGroups() const { return _num_groups; }
+  unsigned int numReactions() const { return _reaction_parents.size(); }
+  unsigned int numNonzeros() const { return _columns.size(); }
+
+  bool hasNuclide(const std::string & name) const { return _indices.count(name) > 0u; }
+  unsigned int index(const std::string & name) const { return _indices.at(name); }
+  const std::string & name(unsigned int i) const { return _names[i]; }
+  const std::vector<std::string> & names() const { return _names; }
+
+  // The CSR sparsity pattern.
+  const std::vector<unsigned int> & rowOffsets() const { return _row_offsets; }
+  const std::vector<unsigned int> & columns() const { return _columns; }
+  // The index of the diagonal of row i in the values of the matrix.
+  unsigned int diagonal(unsigned int i) const { return _diagonals[i]; }
+
+  // The decay part of the matrix (s^{-1}), aligned with columns().
+  const std::vector<Real> & decayValues() const { return _decay_values; }
+
+  // The parent nuclide of a reaction and its group-wise microscopic cross-sections.
+  unsigned int reactionParent(unsigned int r) const { return _reaction_parents[r]; }
+  const Real * reactionCrossSections(unsigned int r) const
+  {
+    return _reaction_xs.data() + r * _num_groups;
+  }
+
+  // Cheap chain queries: the nuclides which feed (or are fed by) nuclide i through any decay or
+  // reaction in the matrix.
+  void getParents(unsigned int i, std::vector<unsigned int> & parents) const;
+  const std::vector<unsigned int> & getChildren(unsigned int i) const { return _children[i]; }
+
+  // Computes the one-group rate (s^{-1}) of every reaction given the group-wise scalar fluxes.
+  void reactionRates(const std::vector<Real> & group_fluxes, std::vector<Real> & rates) const;
+  // Assembles the values of the matrix (aligned with columns()) given the one-group reaction rates.
+  // An empty set of rates assembles the decay matrix.
+  void assemble(const std::vector<Real> & rates, std::vector<Real> & values) const;
+  // Computes y = A x given the values of the matrix.
+  void multiply(const std::vector<Real> & values,
+                const std::vector<Real> & x,
+                std::vector<Real> & y) const;
+
+private:
+  // A single contribution of a one-group reaction rate to the matrix.
+  struct ReactionEntry
+  {
+    unsigned int _value;    // The index of the nonzero in the values of the matrix.
+    unsigned int _reaction; // The index of the reaction.
+    Real _factor;           // The branching factor of the reaction (negative for losses).
+  };
+
+  unsigned int _num_groups;
+
+  std::vector<std::string> _names;
+  std::unordered_map<std::string, unsigned int> _indices;
+
+  std::vector<unsigned int> _row_offsets;
+  std::vector<unsigned int> _columns;
+  std::vector<unsigned int> _diagonals;
+  std::vector<Real> _decay_values;
+
+  std::vector<unsigned int> _reaction_parents;
+  std::vector<Real> _reaction_xs;
+  std::vector<ReactionEntry> _reaction_entries;
+
+  std::vector<std::vector<unsigned int>> _children;
+}; // class BurnupMatrix
+} // namespace NuclearData
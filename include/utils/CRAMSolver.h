@@ -0,0 +1,41 @@
+#pragma once
+
+#include <complex>
+
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+
+#include "BurnupMatrix.h"
+
+namespace NuclearData
+{
+/*
+ * Advances the number densities of the nuclides in a burnup matrix over a timestep,
+ * N(t + dt) = exp(A dt) N(t), with the order 16 Chebyshev Rational Approximation Method (CRAM) in
+ * the incomplete partial fraction form of Pusa (2016). Every step takes one complex sparse solve
+ * per pole of the approximation. The shifted systems (A dt - theta I) share the sparsity pattern of
+ * the burnup matrix, which is analyzed once when the solver is constructed.
+ */
+class CRAMSolver
+{
+public:
+  CRAMSolver(const BurnupMatrix & matrix);
+
+  // Advances the number densities n in place given the values of the burnup matrix (see
+  // BurnupMatrix::assemble()) and the timestep dt.
+  void solve(const std::vector<Real> & values, Real dt, std::vector<Real> & n);
+
+private:
+  using ComplexSparseMatrix = Eigen::SparseMatrix<std::complex<Real>>;
+  using ComplexVector = Eigen::Matrix<std::complex<Real>, Eigen::Dynamic, 1>;
+
+  const BurnupMatrix & _matrix;
+
+  // The shifted system and the position of each nonzero of the burnup matrix in its values.
+  ComplexSparseMatrix _shifted;
+  std::vector<unsigned int> _value_indices;
+
+  Eigen::SparseLU<ComplexSparseMatrix, Eigen::COLAMDOrdering<int>> _lu;
+  ComplexVector _rhs;
+}; // class CRAMSolver
+} // namespace NuclearData
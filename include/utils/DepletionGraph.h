@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Nuclide.h"
+
+namespace NuclearData
+{
+/*
+ * The directed graph of a depletion chain. Every nuclide in the chain, and every decay or reaction
+ * target (even if the target has no depletion data), is a node with an integer index. An edge
+ * j -> i exists if nuclide j produces nuclide i through a decay or a reaction. Adjacency is stored
+ * in compressed form such that chain traversals are linear in the size of the chain.
+ *
+ * The strongly connected components of the graph are found once (Tarjan's algorithm) to provide a
+ * topological ordering of the nuclides, parents before children. Nuclides which belong to a cycle
+ * (ex: an (n,2n) reaction followed by a beta- decay) share a component and are ordered arbitrarily
+ * within it.
+ */
+class DepletionGraph
+{
+public:
+  DepletionGraph() = default;
+  DepletionGraph(const std::unordered_map<std::string, Nuclide> & chain);
+
+  unsigned int numNodes() const { return _names.size(); }
+  bool hasNode(const std::string & name) const { return _indices.count(name) > 0u; }
+  unsigned int index(const std::string & name) const { return _indices.at(name); }
+  const std::string & name(unsigned int i) const { return _names[i]; }
+
+  // The nuclides produced by nuclide i.
+  const unsigned int * childrenBegin(unsigned int i) const
+  {
+    return _children.data() + _child_offsets[i];
+  }
+  const unsigned int * childrenEnd(unsigned int i) const
+  {
+    return _children.data() + _child_offsets[i + 1u];
+  }
+
+  // The position of nuclide i in the topological ordering of the chain.
+  unsigned int rank(unsigned int i) const { return _ranks[i]; }
+  // The cycles of the chain, one set of nuclides per strongly connected component.
+  const std::vector<std::vector<unsigned int>> & cycles() const { return _cycles; }
+
+  // All nodes reachable from the given nodes (including themselves) in topological order.
+  std::vector<unsigned int> reachable(const std::vector<unsigned int> & initial) const;
+
+private:
+  void addNode(const std::string & name);
+  void findComponents();
+
+  std::vector<std::string> _names;
+  std::unordered_map<std::string, unsigned int> _indices;
+
+  std::vector<unsigned int> _child_offsets;
+  std::vector<unsigned int> _children;
+
+  std::vector<unsigned int> _ranks;
+  std::vector<std::vector<unsigned int>> _cycles;
+}; // class DepletionGraph
+} // namespace NuclearData
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * A compact binary layout for the multigroup cross-section libraries written by gnat_mgxs.py.
+ * Binary libraries are memory-mapped and read in place instead of being parsed as text. Both the
+ * macroscopic libraries (root 'macroscopic_cross_sections') and the microscopic depletion
+ * libraries (root 'depletion_chain') are supported. A library is stored as:
+ *
+ * | FileHeader | Record[_num_records] | string table | float64 data |
+ *
+ * Every string (units, domain IDs, nuclide names and reaction types) is stored once in a table of
+ * null-terminated strings and referenced by its byte offset into the table. The string at offset 0
+ * is always empty. Every cross-section array is stored contiguously in the data section and
+ * referenced by its offset (in values) into the section. The group boundaries are the first
+ * _num_group_bounds values of the data section. All values are stored in the native byte order
+ * of the machine which wrote the library, which is recorded by writing byte_order_mark. Libraries
+ * written with a different byte order are rejected.
+ */
+namespace MGXSBinary
+{
+constexpr char magic[8] = {'G', 'N', 'A', 'T', 'M', 'G', 'X', 'S'};
+constexpr std::uint32_t version = 2u;
+constexpr std::uint32_t byte_order_mark = 0x01020304u;
+
+struct FileHeader
+{
+  char _magic[8];
+  std::uint32_t _byte_order;
+  std::uint32_t _version;
+  std::uint32_t _num_groups;
+  std::uint32_t _root;
+  std::uint32_t _energy_units;
+  std::uint32_t _xs_units;
+  std::uint32_t _num_records;
+  std::uint32_t _num_group_bounds;
+  std::uint64_t _strings_offset; // In bytes from the start of the file.
+  std::uint64_t _strings_size;   // In bytes.
+  std::uint64_t _data_offset;    // In bytes from the start of the file.
+  std::uint64_t _data_size;      // In values.
+};
+static_assert(sizeof(FileHeader) == 72u, "Unexpected padding in MGXSBinary::FileHeader.");
+
+// A single cross-section array. _nuclide is empty for macroscopic libraries.
+struct Record
+{
+  std::uint32_t _domain;
+  std::uint32_t _nuclide;
+  std::uint32_t _type;
+  std::uint32_t _num_legendre;
+  std::uint64_t _offset; // In values from the start of the data section.
+  std::uint64_t _size;   // In values.
+};
+static_assert(sizeof(Record) == 32u, "Unexpected padding in MGXSBinary::Record.");
+
+// A read-only view of a contiguous array of values.
+struct ArrayView
+{
+  const double * begin() const { return _data; }
+  const double * end() const { return _data + _size; }
+  std::size_t size() const { return _size; }
+  const double & operator[](std::size_t i) const { return _data[i]; }
+
+  const double * _data = nullptr;
+  std::size_t _size = 0u;
+};
+
+// A library held in memory, used to convert the XML libraries to the binary layout.
+struct Library
+{
+  struct Entry
+  {
+    std::string _domain;
+    std::string _nuclide;
+    std::string _type;
+    unsigned int _num_legendre;
+    std::vector<double> _values;
+  };
+
+  std::string _root;
+  std::string _energy_units;
+  std::string _xs_units;
+  unsigned int _num_groups = 0u;
+  std::vector<double> _group_bounds;
+  std::vector<Entry> _entries;
+};
+
+// Whether or not the file starts with the binary library magic number.
+bool isBinary(const std::string & file_name);
+
+// Parse an XML library written by gnat_mgxs.py. Returns false and sets error on failure.
+bool readXML(const std::string & file_name, Library & library, std::string & error);
+// Write a library in the binary layout. Returns false and sets error on failure.
+bool write(const std::string & file_name, const Library & library, std::string & error);
+
+// A memory-mapped binary library. The arrays are read in place, without copies.
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+
+  // Map and validate the file. Returns false and sets error on failure.
+  bool open(const std::string & file_name, std::string & error);
+
+  unsigned int numGroups() const { return header()._num_groups; }
+  const char * root() const { return string(header()._root); }
+  const char * energyUnits() const { return string(header()._energy_units); }
+  const char * xsUnits() const { return string(header()._xs_units); }
+  ArrayView groupBounds() const { return {data(), header()._num_group_bounds}; }
+
+  std::size_t numRecords() const { return header()._num_records; }
+  const Record & record(std::size_t i) const
+  {
+    return reinterpret_cast<const Record *>(_map + sizeof(FileHeader))[i];
+  }
+  const char * string(std::uint32_t offset) const
+  {
+    return reinterpret_cast<const char *>(_map + header()._strings_offset) + offset;
+  }
+  ArrayView values(const Record & record) const
+  {
+    return {data() + record._offset, static_cast<std::size_t>(record._size)};
+  }
+
+private:
+  const FileHeader & header() const { return *reinterpret_cast<const FileHeader *>(_map); }
+  const double * data() const
+  {
+    return reinterpret_cast<const double *>(_map + header()._data_offset);
+  }
+
+  const unsigned char * _map = nullptr;
+  std::size_t _map_size = 0u;
+}; // class MappedFile
+} // namespace MGXSBinary
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "GnatBase.h"
+
+// Compile-time descriptions of the l -> m flux moment ordering for each problem dimensionality. SN
+// objects instantiate their moment loops on the ProblemType such that the trip count of the inner
+// m loop is known without a runtime branch on the dimensionality.
+namespace MomentOrdering
+{
+// The number of orders m stored for degree l. 1D problems only require Legendre moments, 2D
+// problems require the moments with m >= 0, and 3D problems require all moments.
+template <ProblemType P>
+constexpr unsigned int
+numOrders(unsigned int l)
+{
+  if constexpr (P == ProblemType::Cartesian1D)
+    return 1u;
+  else if constexpr (P == ProblemType::Cartesian2D)
+    return l + 1u;
+  else
+    return 2u * l + 1u;
+}
+
+// The first order m stored for degree l.
+template <ProblemType P>
+constexpr int
+firstOrder(unsigned int l)
+{
+  if constexpr (P == ProblemType::Cartesian3D)
+    return -1 * static_cast<int>(l);
+  else
+    return 0;
+}
+
+// The number of moments stored up to (and including) degree l.
+template <ProblemType P>
+constexpr unsigned int
+numMoments(unsigned int l)
+{
+  if constexpr (P == ProblemType::Cartesian1D)
+    return l + 1u;
+  else if constexpr (P == ProblemType::Cartesian2D)
+    return (l + 1u) * (l + 2u) / 2u;
+  else
+    return (l + 1u) * (l + 1u);
+}
+
+// Evaluates sum_{l = 0}^{L} (2l + 1) / (4 pi) sum_{m} S_{l,m} Y_{l,m} for moments and harmonics
+// stored in the l -> m ordering.
+template <ProblemType P>
+Real
+expand(const Real * moments, const Real * y_l_m, unsigned int max_anisotropy)
+{
+  Real res = 0.0;
+  unsigned int k = 0u;
+  for (unsigned int l = 0u; l <= max_anisotropy; ++l)
+  {
+    Real src_l = 0.0;
+    for (unsigned int m = 0u; m < numOrders<P>(l); ++m, ++k)
+      src_l += moments[k] * y_l_m[k];
+
+    res += src_l * (2.0 * static_cast<Real>(l) + 1.0) / (4.0 * libMesh::pi);
+  }
+
+  return res;
+}
+} // namespace MomentOrdering
@@ -7,11 +7,15 @@ namespace NuclearData
 class Nuclide
 {
 public:
+  // The nuclide tables below are built once on first use. Hot paths should resolve nuclide names
+  // to their ZAI (or the requested data) once during setup.
   static NuclearData::ZAI getZAI(const std::string & nuclide_name);
   static std::string getElement(const std::string & nuclide_name);
   static bool isElement(const std::string & name);
-  static std::vector<std::pair<std::string, Real>> getAbundances(const std::string & element_name);
+  static const std::vector<std::pair<std::string, Real>> &
+  getAbundances(const std::string & element_name);
   static Real getAtomicMass(const std::string & nuclide_name);
+  static Real getAtomicMass(const NuclearData::ZAI & z_a_i);
 
   Nuclide(const std::string & name, const Real & half_life);
 
@@ -14,6 +14,19 @@ public:
   static Real evaluateCoefficient(unsigned int degree, int order);
   static Real evaluate(unsigned int degree, int order, const Real & mu, const Real & omega);
 
+  // Evaluates every real spherical harmonic up to max_degree for a single direction in one pass
+  // using the three-term recurrence of the normalized associated Legendre polynomials. The results
+  // are stored in y_l_m in the order l -> m (m = -l, ..., l), see index().
+  static void evaluateAll(unsigned int max_degree,
+                          const Real & mu,
+                          const Real & omega,
+                          std::vector<Real> & y_l_m);
+  // The index of Y_{l,m} in the output of evaluateAll().
+  static unsigned int index(unsigned int degree, int order)
+  {
+    return static_cast<unsigned int>(static_cast<int>(degree * (degree + 1u)) + order);
+  }
+
   RealSphericalHarmonics(unsigned int degree);
 
   Real evaluatePrecomputed(unsigned int degree, int order, const Real & mu, const Real & omega);
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <vector>
+
+#include "MooseTypes.h"
+
+/*
+ * The scattering data of a transport material stored in a single contiguous record. Materials with
+ * block-constant cross-sections own one record and publish a pointer to it at every quadrature
+ * point, which avoids copying the G^2 (L + 1) scattering matrix into each quadrature point.
+ *
+ * The scattering cross-sections are indexed as SigmaS_{g', g, l} and flattened in the order of
+ * initial group first, final group second, and Legendre polynomial third (see index()).
+ *
+ * The nonzero source groups of destination group g are _sources[i] with
+ * _offsets[g] <= i < _offsets[g + 1]. _source_anisotropy[i] is the highest nonzero Legendre order
+ * of the transfer.
+ */
+struct ScatteringCrossSections
+{
+  ScatteringCrossSections(unsigned int num_groups = 0u) { reset(num_groups, 0u); }
+
+  // Resize the record to describe a purely absorbing medium (no scattering).
+  void reset(unsigned int num_groups, unsigned int anisotropy);
+
+  // Rebuild the compressed scattering structure from _sigma_s_g_prime_g_l.
+  void compress();
+
+  // Whether the medium has any scattering data.
+  bool empty() const { return _sigma_s_g_prime_g_l.size() == 0u; }
+
+  // The index of SigmaS_{g', g, 0} in _sigma_s_g_prime_g_l.
+  unsigned int index(unsigned int g_prime, unsigned int g) const
+  {
+    return (g_prime * _num_groups + g) * (_anisotropy + 1u);
+  }
+
+  unsigned int _num_groups;
+  unsigned int _anisotropy;
+  std::vector<Real> _sigma_s_g_prime_g_l;
+
+  std::vector<unsigned int> _offsets;
+  std::vector<unsigned int> _sources;
+  std::vector<unsigned int> _source_anisotropy;
+}; // struct ScatteringCrossSections
@@ -0,0 +1,151 @@
+# Group-wise decay photon sources of stationary radionuclides computed by ParticleDecaySourceArray
+# in a single pass, compared against one ParticleDecaySource per group. cs137_photon_chain.xml is
+# test data with a single photon line per nuclide: Cs137 emits at 32.194 keV (group 1) at a rate
+# of 2.658e-11 s^-1 and Ba137_m1 emits at 661.657 keV (group 0) at a rate of 4.0733e-3 s^-1. The
+# gold file holds the analytical sources S_0 = 4.0733e-3 N_{Ba137_m1} and S_1 = 2.658e-11 N_{Cs137},
+# and a zero difference between both auxkernels.
+
+[DepletionLibrary]
+  depletion_file = 'cs137_photon_chain.xml'
+  depletion_file_source = openmc
+  show_warnings = false
+  add_data_userobject = true
+[]
+
+[Mesh]
+  [domain]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 2
+    ny = 2
+  []
+[]
+
+[AuxVariables]
+  [Cs137]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 1.0e12
+  []
+  [Ba137_m1]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 1.0e5
+  []
+  [Ba137]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 1.0
+  []
+
+  [photon_source_g_0]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [photon_source_g_1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [photon_source]
+    order = CONSTANT
+    family = MONOMIAL
+    components = 2
+  []
+  [photon_source_array_g_0]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [photon_source_array_g_1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [photon_source_g_0]
+    type = ParticleDecaySource
+    variable = photon_source_g_0
+    particle_type = photon
+    group_boundaries = '2.0e7 1.0e5 0.0'
+    group_index = 0
+    is_fe = true
+    nuclide_vars = 'Cs137 Ba137_m1 Ba137'
+  []
+  [photon_source_g_1]
+    type = ParticleDecaySource
+    variable = photon_source_g_1
+    particle_type = photon
+    group_boundaries = '2.0e7 1.0e5 0.0'
+    group_index = 1
+    is_fe = true
+    nuclide_vars = 'Cs137 Ba137_m1 Ba137'
+  []
+
+  # Also executed on INITIAL so that the components are up to date regardless of the order in which
+  # array and standard auxkernels are executed.
+  [photon_source]
+    type = ParticleDecaySourceArray
+    variable = photon_source
+    particle_type = photon
+    group_boundaries = '2.0e7 1.0e5 0.0'
+    is_fe = true
+    nuclide_vars = 'Cs137 Ba137_m1 Ba137'
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [photon_source_array_g_0]
+    type = ArrayVariableComponent
+    variable = photon_source_array_g_0
+    array_variable = photon_source
+    component = 0
+  []
+  [photon_source_array_g_1]
+    type = ArrayVariableComponent
+    variable = photon_source_array_g_1
+    array_variable = photon_source
+    component = 1
+  []
+[]
+
+[Postprocessors]
+  [photon_source_g_0_avg]
+    type = ElementAverageValue
+    variable = photon_source_g_0
+  []
+  [photon_source_g_1_avg]
+    type = ElementAverageValue
+    variable = photon_source_g_1
+  []
+  [photon_source_array_g_0_avg]
+    type = ElementAverageValue
+    variable = photon_source_array_g_0
+  []
+  [photon_source_array_g_1_avg]
+    type = ElementAverageValue
+    variable = photon_source_array_g_1
+  []
+  [photon_source_difference_g_0]
+    type = ElementL2Difference
+    variable = photon_source_array_g_0
+    other_variable = photon_source_g_0
+  []
+  [photon_source_difference_g_1]
+    type = ElementL2Difference
+    variable = photon_source_array_g_1
+    other_variable = photon_source_g_1
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'TIMESTEP_END'
+[]
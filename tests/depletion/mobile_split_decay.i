@@ -0,0 +1,65 @@
+# Decay of S37 into Cl37 in a stagnant fluid with a uniform composition, such that mass transport
+# leaves the mass fractions unchanged. With split reactions the decay is integrated exactly by CRAM
+# and the mass fractions match the analytical solutions in the gold file,
+# w_{S37}(t) = exp(-ln(2) t / 303) and w_{Cl37}(t) = (1 - w_{S37}(t)) A_{Cl37} / A_{S37}.
+# Without split reactions the decay is integrated with implicit Euler, which is only accurate to a
+# few percent for this timestep.
+
+[DepletionLibrary]
+  depletion_file = '../../data/depl/chain_endfb71_pwr_air.xml'
+  depletion_file_source = openmc
+  show_warnings = false
+  add_data_userobject = true
+[]
+
+[Mesh]
+  [domain]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 2
+    ny = 2
+  []
+[]
+
+[MobileDepletionSystem]
+  scheme = fv
+  split_reactions = true
+
+  u = 0.0
+  v = 0.0
+  density = 0.001276
+  dynamic_viscosity = 0.0001722
+  temperature = 300.0
+  turbulence_handling = none
+
+  extra_nuclides = 'S37'
+  extra_nuclide_atom_fractions = '1.0'
+
+  debug_filter_nuclides = 'S37 Cl37'
+[]
+
+[Postprocessors]
+  [S37_avg]
+    type = ElementAverageValue
+    variable = S37_mass_fraction
+  []
+  [Cl37_avg]
+    type = ElementAverageValue
+    variable = Cl37_mass_fraction
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_factor_shift_type'
+  petsc_options_value = ' lu       NONZERO'
+  num_steps = 10
+  dt = 30.0
+  nl_abs_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'TIMESTEP_END'
+[]
@@ -0,0 +1,66 @@
+# Decay of stationary nuclides with the CRAM scheme of the tracer depletion system. B12 decays
+# with a half-life of 20.2 ms, such that the timestep is three orders of magnitude larger than its
+# half-life. S37 decays into Cl37 with a half-life of 303 s. The gold file holds the analytical
+# solutions N_{S37}(t) = exp(-ln(2) t / 303) and N_{Cl37}(t) = 1 - N_{S37}(t).
+
+[DepletionLibrary]
+  depletion_file = '../../data/depl/chain_endfb71_pwr_air.xml'
+  depletion_file_source = openmc
+  show_warnings = false
+  add_data_userobject = true
+[]
+
+[Mesh]
+  [domain]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 2
+    ny = 2
+  []
+[]
+
+[TracerDepletionSystem]
+  scheme = cram
+  temperature = 300.0
+
+  extra_nuclides = 'B12 S37'
+  extra_nuclide_number_densities = '1.0 1.0'
+
+  debug_filter_nuclides = 'B12 C12 S37 Cl37'
+[]
+
+[Postprocessors]
+  [B12_avg]
+    type = ElementAverageValue
+    variable = B12
+  []
+  [C12_avg]
+    type = ElementAverageValue
+    variable = C12
+  []
+  [S37_avg]
+    type = ElementAverageValue
+    variable = S37
+  []
+  [Cl37_avg]
+    type = ElementAverageValue
+    variable = Cl37
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 60.0
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'TIMESTEP_END'
+[]
@@ -0,0 +1,105 @@
+# A scattering medium with a uniform volumetric source, solved with both the array_saaf_cfem scheme
+# and the saaf_cfem scheme. Point sources are not supported by the array scheme, so the
+# saaf_cgfem gold files can't be reused. Instead the saaf_cfem system acts as the baseline and the
+# L2 difference between the two scalar fluxes is checked.
+
+[Mesh]
+  [domain]
+    type = CartesianMeshGenerator
+    dim = 1
+    dx = 10
+    ix = 100
+  []
+[]
+
+[TransportSystems]
+  [Neutron]
+    scheme = array_saaf_cfem
+    particle_type = neutron
+    num_groups = 1
+
+    order = FIRST
+    family = LAGRANGE
+
+    n_azimuthal = 1
+    n_polar = 1
+
+    max_anisotropy = 0
+    vacuum_boundaries = 'left right'
+
+    volumetric_source_blocks = '0'
+    volumetric_source_moments = '1.0'
+    volumetric_source_anisotropies = '0'
+
+    debug_verbosity = level0
+  []
+  [Baseline]
+    scheme = saaf_cfem
+    particle_type = neutron
+    num_groups = 1
+    use_scattering_jacobians = true
+    angular_flux_names = 'baseline_angular_flux'
+    flux_moment_names = 'baseline_flux_moment'
+
+    order = FIRST
+    family = LAGRANGE
+
+    n_azimuthal = 1
+    n_polar = 1
+
+    max_anisotropy = 0
+    vacuum_boundaries = 'left right'
+
+    volumetric_source_blocks = '0'
+    volumetric_source_moments = '1.0'
+    volumetric_source_anisotropies = '0'
+
+    debug_verbosity = level0
+  []
+[]
+
+[TransportMaterials]
+  [Domain]
+    type = ConstantTransportMaterial
+    transport_system = Neutron
+    anisotropy = 0
+    group_total = 2.0
+    group_scattering = 1.0
+    group_speeds = 2200.0
+  []
+  [BaselineDomain]
+    type = ConstantTransportMaterial
+    transport_system = Baseline
+    anisotropy = 0
+    group_total = 2.0
+    group_scattering = 1.0
+    group_speeds = 2200.0
+  []
+[]
+
+[Postprocessors]
+  [scalar_flux_difference]
+    type = ElementL2Difference
+    variable = flux_moment_1_0_0
+    other_variable = baseline_flux_moment_1_0_0
+  []
+[]
+
+[Problem]
+  type = FEProblem
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'TIMESTEP_END'
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  line_search = default
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart'
+  petsc_options_value = 'hypre boomeramg 10'
+  l_max_its = 50
+  nl_rel_tol = 1e-12
+[]
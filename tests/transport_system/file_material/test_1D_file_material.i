@@ -0,0 +1,65 @@
+# Two file-based transport materials which read from the same cross-section file. The materials are
+# added through the TransportMaterials syntax without providing a cross-section library, so a single
+# shared library must be created by the material action. Every library reports when it has been
+# loaded, the test checks that this happens exactly once.
+
+[Mesh]
+  [domain]
+    type = CartesianMeshGenerator
+    dim = 1
+    dx = '5 5'
+    ix = '50 50'
+    subdomain_id = '0 1'
+  []
+[]
+
+[TransportSystems]
+  [Neutron]
+    scheme = saaf_cfem
+    particle_type = neutron
+    num_groups = 8
+
+    order = FIRST
+    family = LAGRANGE
+
+    n_azimuthal = 1
+    n_polar = 1
+
+    max_anisotropy = 0
+    vacuum_boundaries = 'left right'
+
+    volumetric_source_blocks = '1'
+    volumetric_source_moments = '1.0 0.0 0.0 0.0 0.0 0.0 0.0 0.0'
+    volumetric_source_anisotropies = '0'
+
+    debug_verbosity = level0
+  []
+[]
+
+[TransportMaterials]
+  [Air]
+    type = FileTransportMaterial
+    transport_system = Neutron
+    file_name = '../../../data/mgxs/sc_st_8g_xs_macro.xml'
+    source_material_id = '5'
+    block = 0
+  []
+  [Fuel]
+    type = FileTransportMaterial
+    transport_system = Neutron
+    file_name = '../../../data/mgxs/sc_st_8g_xs_macro.xml'
+    source_material_id = '7'
+    block = 1
+  []
+[]
+
+[Problem]
+  type = FEProblem
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
@@ -0,0 +1,78 @@
+# The scattering test case from saaf_cgfem, solved with source iteration accelerated by diffusion
+# synthetic acceleration instead of a monolithic solve. The converged solution is compared against
+# the monolithic gold file.
+
+[Mesh]
+  [domain]
+    type = CartesianMeshGenerator
+    dim = 1
+    dx = 10
+    ix = 100
+  []
+[]
+
+[TransportSystems]
+  [Neutron]
+    scheme = saaf_cfem
+    particle_type = neutron
+    num_groups = 1
+    output_angular_fluxes = true
+
+    order = FIRST
+    family = LAGRANGE
+
+    n_azimuthal = 1
+    n_polar = 1
+
+    max_anisotropy = 0
+    vacuum_boundaries = 'left right'
+
+    point_source_locations = '5.0 0.0 0.0'
+    point_source_moments = '1000.0'
+    point_source_anisotropies = '0'
+
+    source_iteration = true
+    use_dsa = true
+    print_source_iteration_report = false
+
+    debug_verbosity = level0
+  []
+[]
+
+[TransportMaterials]
+  [Domain1]
+    type = ConstantTransportMaterial
+    transport_system = Neutron
+    anisotropy = 0
+    group_total = 2.0
+    group_scattering = 1.0
+    group_speeds = 2200.0
+  []
+[]
+
+[Problem]
+  type = FEProblem
+[]
+
+[Outputs]
+  file_base = 'test_1D_scattering_steady_out'
+  hide = 'flux_moment_1_dsa_correction'
+  exodus = true
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  line_search = default
+  petsc_options_iname = '-pc_type -pc_hypre_type -ksp_gmres_restart'
+  petsc_options_value = 'hypre boomeramg 10'
+  l_max_its = 50
+  nl_rel_tol = 1e-12
+
+  fixed_point_max_its = 200
+  disable_fixed_point_residual_norm_check = true
+  custom_pp = SourceIterationChange_Neutron
+  direct_pp_value = true
+  custom_abs_tol = 1e-10
+  custom_rel_tol = 1e-50
+[]
@@ -0,0 +1,87 @@
+# A ray traced uncollided flux from a point source in a purely absorbing medium. The total
+# cross-section is increased after the second timestep, such that the uncollided flux changes once
+# over the course of the transient. The uncollided flux traced from scratch every timestep is
+# written to traced/ and acts as the baseline for the accelerated ray tracing options.
+
+[Mesh]
+  [domain]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 10
+    ny = 10
+    xmax = 10.0
+    ymax = 10.0
+  []
+[]
+
+[UncollidedFlux]
+  [Neutron]
+    uncollided_flux_treatment = ray-tracing
+    num_groups = 1
+    max_anisotropy = 0
+
+    point_source_locations = '4.5 5.5 0.0'
+    point_source_moments = '1000.0'
+    point_source_anisotropies = '0'
+
+    rt_n_polar = 2
+    rt_n_azimuthal = 2
+  []
+[]
+
+[Functions]
+  [total_xs]
+    type = ParsedFunction
+    expression = 'if(t < 2.5, 0.5, 0.7)'
+  []
+[]
+
+[AuxVariables]
+  [total_xs]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [total_xs]
+    type = FunctionAux
+    variable = total_xs
+    function = total_xs
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[TransportMaterials]
+  [Domain]
+    type = PropsFromVarTransportMaterial
+    transport_system = Neutron
+    total_xs = total_xs
+    scatter_xs = 0.0
+    inv_vel = 1.0
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+  material_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 1.0
+[]
+
+[Outputs]
+  [exodus]
+    type = Exodus
+    execute_postprocessors_on = NONE
+  []
+  [csv]
+    type = CSV
+    execute_on = 'TIMESTEP_END'
+  []
+[]
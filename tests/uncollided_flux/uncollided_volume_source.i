@@ -0,0 +1,64 @@
+# A ray traced uncollided flux from a volumetric source in the middle of a purely absorbing medium.
+# The uncollided flux traced with one ray per source quadrature point is written to traced/ and acts
+# as the baseline for the adaptive ray budget. With a tolerance of 0.05 the source elements are too
+# optically thick to be lumped whole (sigma_t h ~ 0.07) and are refined into quadrants, which are
+# lumped for targets further than ~1.6 away.
+
+[Mesh]
+  [domain]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 20
+    ny = 20
+    xmax = 10.0
+    ymax = 10.0
+  []
+  [source]
+    type = SubdomainBoundingBoxGenerator
+    input = domain
+    block_id = 1
+    bottom_left = '4.0 4.0 0.0'
+    top_right = '6.0 6.0 0.0'
+  []
+[]
+
+[UncollidedFlux]
+  [Neutron]
+    uncollided_flux_treatment = ray-tracing
+    num_groups = 1
+    max_anisotropy = 0
+
+    volumetric_source_blocks = '1'
+    volumetric_source_moments = '10.0'
+    volumetric_source_anisotropies = '0'
+
+    rt_volume_order = FOURTH
+    rt_n_polar = 2
+    rt_n_azimuthal = 2
+  []
+[]
+
+[TransportMaterials]
+  [Domain]
+    type = AbsorbingTransportMaterial
+    transport_system = Neutron
+    group_total = 0.1
+    group_speeds = 2200.0
+  []
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+  material_coverage_check = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  exodus = true
+  execute_on = 'TIMESTEP_END'
+[]